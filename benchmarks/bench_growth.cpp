@@ -0,0 +1,140 @@
+/**
+ * @file bench_growth.cpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Benchmark of the growth policies of the array based containers.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "../sources/Deque/ArrayDeque.hpp"
+#include "../sources/List/ArrayList.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace hellods;
+
+// Element of a typical small record size.
+struct Record
+{
+    long long key;
+    double values[2];
+
+    Record(int key = 0)
+        : key(key)
+        , values{}
+    {
+    }
+};
+
+// Result of appending n elements to an empty container.
+struct Result
+{
+    long long allocations; // number of buffers allocated
+    long long copies;      // number of elements moved to a new buffer
+    long long slack;       // unused capacity at the end, in bytes
+    double millis;         // wall time of the appending alone
+};
+
+// Append n elements to an empty container with the given append function, recording every capacity change.
+template <typename C, typename Append>
+Result measure(int n, Append append)
+{
+    Result result = {0, 0, 0, 0};
+
+    // first pass: count the reallocations, the capacity is checked after every insertion
+    {
+        C container;
+        auto capacity = container.capacity();
+        for (int i = 0; i < n; i++)
+        {
+            append(container, i);
+            if (container.capacity() != capacity)
+            {
+                result.allocations++;
+                result.copies += i; // the i elements before this one were moved
+                capacity = container.capacity();
+            }
+        }
+        result.slack = (long long)(capacity - container.size()) * sizeof(*container.begin());
+    }
+
+    // second pass: time the appending alone
+    auto start = std::chrono::steady_clock::now();
+    {
+        C container;
+        for (int i = 0; i < n; i++)
+        {
+            append(container, i);
+        }
+    }
+    result.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    return result;
+}
+
+// Print one row of the report.
+void report(const char* name, const Result& result)
+{
+    std::printf("  %-18s %12lld %14lld %14lld %10.2f\n", name, result.allocations, result.copies, result.slack, result.millis);
+}
+
+// Benchmark all growth policies on a list of T.
+template <typename T>
+void bench_list(const char* title, int n)
+{
+    auto append = [](auto& list, int i)
+    {
+        list.insert(list.size(), T{i});
+    };
+
+    std::printf("ArrayList<%s>, %d appends\n", title, n);
+    std::printf("  %-18s %12s %14s %14s %10s\n", "policy", "allocations", "copies", "slack (bytes)", "time (ms)");
+    report("DoubleGrowth", measure<ArrayList<T, common::NoShrink, common::DoubleGrowth>>(n, append));
+    report("HalfGrowth", measure<ArrayList<T, common::NoShrink, common::HalfGrowth>>(n, append));
+    report("FixedGrowth<4096>", measure<ArrayList<T, common::NoShrink, common::FixedGrowth<4096>>>(n, append));
+    report("SizeClassGrowth", measure<ArrayList<T, common::NoShrink, common::SizeClassGrowth>>(n, append));
+    std::printf("\n");
+}
+
+// Benchmark all growth policies on a deque of T.
+template <typename T>
+void bench_deque(const char* title, int n)
+{
+    auto append = [](auto& deque, int i)
+    {
+        deque.push_back(T{i});
+    };
+
+    std::printf("ArrayDeque<%s>, %d appends\n", title, n);
+    std::printf("  %-18s %12s %14s %14s %10s\n", "policy", "allocations", "copies", "slack (bytes)", "time (ms)");
+    report("DoubleGrowth", measure<ArrayDeque<T, common::NoShrink, common::DoubleGrowth>>(n, append));
+    report("HalfGrowth", measure<ArrayDeque<T, common::NoShrink, common::HalfGrowth>>(n, append));
+    report("FixedGrowth<4096>", measure<ArrayDeque<T, common::NoShrink, common::FixedGrowth<4096>>>(n, append));
+    report("SizeClassGrowth", measure<ArrayDeque<T, common::NoShrink, common::SizeClassGrowth>>(n, append));
+    std::printf("\n");
+}
+
+int main(void)
+{
+    bench_list<int>("int", 1000000);
+    bench_list<Record>("Record", 1000000);
+    bench_deque<int>("int", 1000000);
+    bench_deque<Record>("Record", 1000000);
+
+    return 0;
+}
@@ -24,13 +24,20 @@
 #define ARRAYDEQUE_HPP
 
 #include "../common/Container.hpp"
+#include "../common/policy.hpp"
+#include "../common/search.hpp"
 #include "../common/utility.hpp"
 
+#include <iterator> // std::random_access_iterator_tag
+
 namespace hellods
 {
 
 /// Deque implemented by array.
-template <typename T>
+///
+/// The shrink policy (such as common::QuarterShrink) decides whether removals release memory automatically,
+/// and the growth policy (such as common::HalfGrowth) decides how much the capacity grows when it runs out.
+template <typename T, typename Shrink = common::NoShrink, typename Growth = common::DoubleGrowth>
 class ArrayDeque : public common::Container
 {
 public:
@@ -40,62 +47,99 @@ public:
         friend class ArrayDeque;
 
     protected:
-        // Current data pointer.
-        T* current_;
-
         // Begin of the ring buffer.
-        T* buffer_begin_;
+        T* buffer_;
+
+        // Index of front in the ring buffer.
+        size_type front_;
+
+        // Capacity of the ring buffer.
+        size_type capacity_;
 
-        // End of the ring buffer.
-        T* buffer_end_;
+        // Logic index of the current element, so that end() differs from begin() even if the deque is full.
+        size_type index_;
 
-        // Create an iterator that point to the current data of list.
-        Iterator(T* current, T* begin, T* end)
-            : current_(current)
-            , buffer_begin_(begin)
-            , buffer_end_(end)
+        // Create an iterator that point to the element at the logic index of the deque.
+        Iterator(T* buffer, size_type front, size_type capacity, size_type index)
+            : buffer_(buffer)
+            , front_(front)
+            , capacity_(capacity)
+            , index_(index)
         {
         }
 
     public:
-        using iterator_category = std::input_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using value_type = T;
-        using difference_type = int;
+        using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
 
+        /// Create a singular iterator.
+        Iterator()
+            : Iterator(nullptr, 0, 0, 0)
+        {
+        }
+
         /// Dereference.
         T& operator*() const
         {
-            return *current_;
+            return (*this)[0];
         }
 
         /// Get current pointer.
         T* operator->() const
         {
-            return current_;
+            return &(*this)[0];
+        }
+
+        /// Access the element at the offset from the iterator: it[n].
+        T& operator[](difference_type n) const
+        {
+            size_type index = front_ + index_ + n;
+            return buffer_[index < capacity_ ? index : index - capacity_];
         }
 
         /// Check if two iterators are same.
         bool operator==(const Iterator& that) const
         {
-            return current_ == that.current_;
+            return index_ == that.index_;
         }
 
         /// Check if two iterators are different.
         bool operator!=(const Iterator& that) const
         {
-            return !(current_ == that.current_);
+            return !(index_ == that.index_);
+        }
+
+        /// Check if this iterator is before that iterator.
+        bool operator<(const Iterator& that) const
+        {
+            return index_ < that.index_;
+        }
+
+        /// Check if this iterator is after that iterator.
+        bool operator>(const Iterator& that) const
+        {
+            return that < *this;
+        }
+
+        /// Check if this iterator is not after that iterator.
+        bool operator<=(const Iterator& that) const
+        {
+            return !(that < *this);
+        }
+
+        /// Check if this iterator is not before that iterator.
+        bool operator>=(const Iterator& that) const
+        {
+            return !(*this < that);
         }
 
         /// Increment the iterator: ++it.
         Iterator& operator++()
         {
-            ++current_;
-            if (current_ == buffer_end_)
-            {
-                current_ = buffer_begin_;
-            }
+            ++index_;
             return *this;
         }
 
@@ -103,18 +147,14 @@ public:
         Iterator operator++(int)
         {
             auto it = *this;
-            ++*this;
+            ++index_;
             return it;
         }
 
         /// Decrement the iterator: --it.
         Iterator& operator--()
         {
-            if (current_ == buffer_begin_)
-            {
-                current_ = buffer_end_;
-            }
-            --current_;
+            --index_;
             return *this;
         }
 
@@ -122,45 +162,105 @@ public:
         Iterator operator--(int)
         {
             auto it = *this;
-            --*this;
+            --index_;
             return it;
         }
+
+        /// Advance the iterator by n: it += n.
+        Iterator& operator+=(difference_type n)
+        {
+            index_ += n;
+            return *this;
+        }
+
+        /// Move the iterator back by n: it -= n.
+        Iterator& operator-=(difference_type n)
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        /// Return the iterator advanced by n: it + n.
+        Iterator operator+(difference_type n) const
+        {
+            return Iterator(buffer_, front_, capacity_, index_ + n);
+        }
+
+        /// Return the iterator advanced by n: n + it.
+        friend Iterator operator+(difference_type n, const Iterator& it)
+        {
+            return it + n;
+        }
+
+        /// Return the iterator moved back by n: it - n.
+        Iterator operator-(difference_type n) const
+        {
+            return Iterator(buffer_, front_, capacity_, index_ - n);
+        }
+
+        /// Return the distance from that iterator to this iterator: it1 - it2.
+        difference_type operator-(const Iterator& that) const
+        {
+            return index_ - that.index_;
+        }
     };
 
 private:
     // Index of front in ring buffer. data[front] is the first element, except size == 0.
-    int front_;
+    size_type front_;
 
     // Available capacity.
-    int capacity_;
+    size_type capacity_;
 
     // Pointer to ring buffer.
     T* data_;
 
-    // Convert logic index to ring buffer physical index.
-    int access(int logic_index) const
+    // Convert logic index to ring buffer physical index. Require 0 <= logic_index <= size.
+    size_type access(size_type logic_index) const
+    {
+        size_type index = front_ + logic_index;
+        return index < capacity_ ? index : index - capacity_; // also works for an unallocated deque
+    }
+
+    // Length of the first contiguous segment [front, front + length) of the ring buffer, the rest are in [0, size - length).
+    size_type first_segment() const
+    {
+        return size_ < capacity_ - front_ ? size_ : capacity_ - front_;
+    }
+
+    // Move the elements in order to the front of a new buffer of new_capacity. Require new_capacity >= size.
+    void reallocate(size_type new_capacity)
     {
-        return (front_ + logic_index) % capacity_;
+        T* new_data = new T[new_capacity];
+        size_type first = first_segment();
+        std::move(data_ + front_, data_ + front_ + first, new_data);
+        std::move(data_, data_ + size_ - first, new_data + first);
+
+        delete[] data_;
+        data_ = new_data;
+        front_ = 0;
+        capacity_ = new_capacity;
     }
 
-    // Expand capacity safely for ring buffer. Require size == capacity.
+    // Expand capacity safely for ring buffer as the growth policy decides. Require size == capacity. An unallocated deque starts from INIT_CAPACITY.
     void expand_capacity()
     {
-        capacity_ = (capacity_ < MAX_CAPACITY / 2) ? capacity_ * 2 : MAX_CAPACITY; // double the capacity until MAX_CAPACITY
-        T* new_data = new T[capacity_];
-        int j = 0;
-        for (int i = front_; i < size_; ++i)
+        std::size_t grown = Growth::grow_capacity(capacity_, sizeof(T));
+        reallocate((capacity_ == 0) ? INIT_CAPACITY : (grown < std::size_t(MAX_CAPACITY)) ? size_type(grown) : MAX_CAPACITY); // grow until MAX_CAPACITY
+    }
+
+    // Shrink capacity after removals as the shrink policy decides, but not below INIT_CAPACITY.
+    void shrink()
+    {
+        size_type new_capacity = size_type(Shrink::shrink_capacity(size_, capacity_));
+        if (new_capacity < INIT_CAPACITY)
         {
-            new_data[j++] = data_[i];
+            new_capacity = INIT_CAPACITY;
         }
-        for (int i = 0; i < front_; ++i)
+        if (new_capacity < capacity_)
         {
-            new_data[j++] = data_[i];
+            reallocate(new_capacity);
         }
-
-        delete[] data_;
-        data_ = new_data;
-        front_ = 0;
     }
 
 public:
@@ -168,18 +268,18 @@ public:
      * Constructor / Destructor
      */
 
-    /// Create an empty deque.
-    ArrayDeque()
+    /// Create an empty deque. No memory is allocated until the first insertion.
+    ArrayDeque() noexcept
         : common::Container(0)
         , front_(0)
-        , capacity_(INIT_CAPACITY)
-        , data_(new T[capacity_])
+        , capacity_(0)
+        , data_(nullptr)
     {
     }
 
     /// Create a deque based on the given initializer list.
     ArrayDeque(const std::initializer_list<T>& il)
-        : common::Container(int(il.size()))
+        : common::Container(size_type(il.size()))
         , front_(0)
         , capacity_(size_ > INIT_CAPACITY ? size_ : INIT_CAPACITY)
         , data_(new T[capacity_])
@@ -187,6 +287,64 @@ public:
         std::copy(il.begin(), il.end(), data_);
     }
 
+    /// Create a deque by copying the elements of the given deque. An empty deque allocates nothing.
+    ArrayDeque(const ArrayDeque& that)
+        : common::Container(that.size_)
+        , front_(0)
+        , capacity_(size_ == 0 ? 0 : size_ > INIT_CAPACITY ? size_ : INIT_CAPACITY)
+        , data_(capacity_ == 0 ? nullptr : new T[capacity_])
+    {
+        std::copy(that.begin(), that.end(), data_);
+    }
+
+    /// Create a deque by taking over the buffer of the given deque, which is left empty.
+    ArrayDeque(ArrayDeque&& that) noexcept
+        : common::Container(that.size_)
+        , front_(that.front_)
+        , capacity_(that.capacity_)
+        , data_(that.data_)
+    {
+        that.size_ = 0;
+        that.front_ = 0;
+        that.capacity_ = 0;
+        that.data_ = nullptr;
+    }
+
+    /// Replace the elements of the deque by a copy of the elements of the given deque.
+    ArrayDeque& operator=(const ArrayDeque& that)
+    {
+        if (this != &that)
+        {
+            *this = ArrayDeque(that);
+        }
+        return *this;
+    }
+
+    /// Replace the elements of the deque by taking over the buffer of the given deque, which is left empty.
+    ArrayDeque& operator=(ArrayDeque&& that) noexcept
+    {
+        if (this != &that)
+        {
+            delete[] data_;
+            size_ = that.size_;
+            front_ = that.front_;
+            capacity_ = that.capacity_;
+            data_ = that.data_;
+
+            that.size_ = 0;
+            that.front_ = 0;
+            that.capacity_ = 0;
+            that.data_ = nullptr;
+        }
+        return *this;
+    }
+
+    /// Destroy the deque object.
+    ~ArrayDeque()
+    {
+        delete[] data_;
+    }
+
     /*
      * Comparison
      */
@@ -199,7 +357,7 @@ public:
             return false;
         }
 
-        for (int logic = 0; logic < size_; ++logic)
+        for (size_type logic = 0; logic < size_; ++logic)
         {
             if (data_[access(logic)] != that.data_[that.access(logic)])
             {
@@ -223,13 +381,67 @@ public:
     /// Return an iterator to the first element of the list.
     Iterator begin() const
     {
-        return Iterator(data_ + front_, data_, data_ + capacity_);
+        return Iterator(data_, front_, capacity_, 0);
     }
 
     /// Return an iterator to the element following the last element of the list.
     Iterator end() const
     {
-        return Iterator(data_ + access(size_), data_, data_ + capacity_);
+        return Iterator(data_, front_, capacity_, size_);
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return an iterator to the first occurrence of the specified element, or end() if the deque does not contains the element.
+    Iterator find(const T& element) const
+    {
+        size_type first = first_segment();
+        size_type pos = common::find_index(data_ + front_, first, element);
+        if (pos != first)
+        {
+            return Iterator(data_, front_, capacity_, pos);
+        }
+
+        pos = common::find_index(data_, size_ - first, element);
+        return Iterator(data_, front_, capacity_, first + pos);
+    }
+
+    /// Check whether the deque contains the specified element.
+    bool contains(const T& element) const
+    {
+        size_type first = first_segment();
+        return common::find_index(data_ + front_, first, element) != first || common::find_index(data_, size_ - first, element) != size_ - first;
+    }
+
+    /// Return the number of occurrences of the specified element in the deque.
+    size_type count(const T& element) const
+    {
+        size_type first = first_segment();
+        return common::count_equal(data_ + front_, first, element) + common::count_equal(data_, size_ - first, element);
+    }
+
+    /// Return the smallest element of the deque.
+    T min() const
+    {
+        common::check_empty(size_);
+        size_type first = first_segment();
+        return first == size_ ? common::min_value(data_ + front_, first) : std::min(common::min_value(data_ + front_, first), common::min_value(data_, size_ - first));
+    }
+
+    /// Return the largest element of the deque.
+    T max() const
+    {
+        common::check_empty(size_);
+        size_type first = first_segment();
+        return first == size_ ? common::max_value(data_ + front_, first) : std::max(common::max_value(data_ + front_, first), common::max_value(data_, size_ - first));
+    }
+
+    /// Return the number of elements that the deque can hold without reallocation.
+    size_type capacity() const
+    {
+        return capacity_;
     }
 
     /*
@@ -303,6 +515,7 @@ public:
         T data = std::move(data_[front_]);
         front_ = (front_ + 1) % capacity_;
         size_--;
+        shrink();
 
         return data;
     }
@@ -314,6 +527,7 @@ public:
 
         T data = std::move(data_[access(size_ - 1)]);
         size_--;
+        shrink();
 
         return data;
     }
@@ -325,6 +539,23 @@ public:
         // Managing the pointer is the user's responsibility.
         size_ = 0;
         front_ = 0;
+        shrink();
+    }
+
+    /// Release the unused capacity. An empty deque releases all of its memory.
+    void shrink_to_fit()
+    {
+        if (size_ == 0)
+        {
+            delete[] data_;
+            data_ = nullptr;
+            capacity_ = 0;
+            front_ = 0;
+        }
+        else if (size_ < capacity_)
+        {
+            reallocate(size_);
+        }
     }
 
     /*
@@ -38,7 +38,7 @@ public:
      */
 
     /// Create an empty deque.
-    LinkedDeque()
+    LinkedDeque() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_constructible_v<T>)
         : LinkedList()
     {
     }
@@ -116,7 +116,7 @@ public:
      */
 
     /// Get the number of elements of the deque.
-    int size() const
+    size_type size() const
     {
         return LinkedList::size();
     }
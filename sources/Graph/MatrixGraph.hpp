@@ -1,7 +1,7 @@
 /**
  * @file MatrixGraph.hpp
  * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
- * @brief Graph implemented by adjacency matrix. Default is directed graph.
+ * @brief Graph implemented by adjacency matrix. Default is directed weighted graph.
  * @date 2022.01.29
  *
  * @copyright Copyright (C) 2022
@@ -24,20 +24,39 @@
 #define MATRIXGRAPH_HPP
 
 #include "../common/Container.hpp"
+#include "../common/StampedArray.hpp"
+#include "../common/path.hpp"
 #include "../common/utility.hpp"
 
-#include "../Queue/ArrayQueue.hpp" // for breadth_first_search()
+#include "../Heap/BinaryHeap.hpp"  // for johnson() astar() bidirectional_dijkstra()
+#include "../Queue/ArrayQueue.hpp" // for breadth_first_search() bellman_ford() topological_sort()
+#include "../Set/DisjointSet.hpp"  // for kruskal() boruvka() has_cycle()
+#include "../Stack/ArrayStack.hpp" // for depth_first_search() strongly_connected_components()
+
+#include "SearchWorkspace.hpp"
+
+#include <atomic>  // std::atomic
+#include <bitset>  // std::bitset
+#include <climits> // LLONG_MAX
+#include <cstdint> // std::uint64_t
+#include <new>     // std::align_val_t
+#include <tuple>   // std::tuple
+#include <vector>  // std::vector
 
 namespace hellods
 {
 
-/// Graph implemented by adjacency matrix. Default is directed graph.
-template <bool Directed = true>
+/// Graph implemented by adjacency matrix. Default is directed weighted graph.
+///
+/// The matrix is one contiguous row-major buffer, aligned to a cache line and with every row padded to whole cache lines.
+/// A weighted graph stores an edge weight per cell. An unweighted graph (Weighted = false) stores one bit per cell,
+/// so its rows are scanned a 64-bit word at a time and its edges weigh 1.
+template <bool Directed = true, bool Weighted = true>
 class MatrixGraph : public common::Container
 {
 public:
     /// Vertex type.
-    using V = int;
+    using V = size_type;
 
     /// Edge type.
     using E = int;
@@ -46,40 +65,386 @@ public:
     static const E NO_EDGE = INT_MAX;
 
 private:
-    // Adjacency matrix.
-    E** matrix_;
+    // Cell of the matrix: an edge weight, or a word of 64 adjacency bits if unweighted.
+    using Cell = std::conditional_t<Weighted, E, std::uint64_t>;
 
-    // Free matrix memory.
-    void free_matrix()
+    // Size of a cache line in bytes, the alignment of the buffer and of each row.
+    static const size_type CACHE_LINE = 64;
+
+    // Number of cells in a cache line.
+    static const size_type LINE_CELLS = CACHE_LINE / sizeof(Cell);
+
+    // Direction-optimizing BFS switches to bottom-up steps when the frontier has more than 1/BFS_ALPHA of the unexplored edges,
+    // and back to top-down steps when the frontier has less than 1/BFS_BETA of the vertices (Beamer et al.).
+    static const size_type BFS_ALPHA = 14;
+    static const size_type BFS_BETA = 24;
+
+    // Number of cells of each row, including padding.
+    size_type stride_;
+
+    // Adjacency matrix, row-major.
+    Cell* matrix_;
+
+    // Value of an empty cell, also the padding.
+    static Cell empty_cell()
     {
-        if (matrix_ != nullptr)
+        if constexpr (Weighted)
+        {
+            return NO_EDGE;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    // Return the index of the lowest set bit of a non-zero word.
+    static int lowest_bit(std::uint64_t word)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#else
+        return int(std::bitset<64>((word & (0 - word)) - 1).count());
+#endif
+    }
+
+    // Return the first cell of the row of vertex v.
+    const Cell* row(V v) const
+    {
+        return matrix_ + v * stride_;
+    }
+
+    // Return the weight of the edge from vertex `from` to vertex `to`, or NO_EDGE.
+    E weight(V from, V to) const
+    {
+        if constexpr (Weighted)
+        {
+            return row(from)[to];
+        }
+        else
+        {
+            return (row(from)[to / 64] >> (to % 64) & 1) ? 1 : NO_EDGE;
+        }
+    }
+
+    // Set the cell of the edge from vertex `from` to vertex `to`.
+    void set_edge(V from, V to, E weight)
+    {
+        Cell* cell = matrix_ + from * stride_;
+        if constexpr (Weighted)
+        {
+            cell[to] = weight;
+        }
+        else if (weight != NO_EDGE)
         {
-            for (int i = 0; i < size_; i++)
+            cell[to / 64] |= std::uint64_t(1) << (to % 64);
+        }
+        else
+        {
+            cell[to / 64] &= ~(std::uint64_t(1) << (to % 64));
+        }
+    }
+
+    // Call action(v) for each vertex v adjacent from vertex `from` in ascending order, skipping v that `skip` is true for.
+    // Unweighted rows are scanned a word at a time, so runs of 64 absent edges cost one check.
+    template <typename Skip, typename F>
+    void for_each_adjacent(V from, const Skip& skip, const F& action) const
+    {
+        const Cell* cells = row(from);
+        if constexpr (Weighted)
+        {
+            for (V v = 0; v < size_; v++)
+            {
+                if (cells[v] != NO_EDGE && !skip(v))
+                {
+                    action(v);
+                }
+            }
+        }
+        else
+        {
+            for (size_type w = 0; w * 64 < size_; w++)
+            {
+                for (std::uint64_t word = cells[w]; word != 0; word &= word - 1)
+                {
+                    V v = w * 64 + lowest_bit(word);
+                    if (!skip(v))
+                    {
+                        action(v);
+                    }
+                }
+            }
+        }
+    }
+
+    // Return the first vertex adjacent from vertex `from` not less than `begin`, or size_ if none.
+    V next_adjacent(V from, V begin) const
+    {
+        const Cell* cells = row(from);
+        if constexpr (Weighted)
+        {
+            while (begin < size_ && cells[begin] == NO_EDGE)
             {
-                delete[] matrix_[i];
+                begin++;
+            }
+            return begin;
+        }
+        else
+        {
+            if (begin >= size_)
+            {
+                return size_;
+            }
+            size_type w = begin / 64;
+            std::uint64_t word = cells[w] & (~std::uint64_t(0) << (begin % 64));
+            while (word == 0)
+            {
+                if (++w * 64 >= size_)
+                {
+                    return size_;
+                }
+                word = cells[w];
             }
-            delete[] matrix_;
+            return w * 64 + lowest_bit(word); // the padding bits are never set
         }
     }
 
-    // Depth-first search helper.
+    // Return the number of edges from vertex `from`.
+    size_type count_adjacent(V from) const
+    {
+        const Cell* cells = row(from);
+        size_type degree = 0;
+        if constexpr (Weighted)
+        {
+            for (V v = 0; v < size_; v++)
+            {
+                degree += cells[v] != NO_EDGE;
+            }
+        }
+        else
+        {
+            for (size_type w = 0; w * 64 < size_; w++)
+            {
+                degree += std::bitset<64>(cells[w]).count();
+            }
+        }
+        return degree;
+    }
+
+    // Return the bit rows of the in-edges: bit u of row v is set if there is an edge from u to v.
+    // An undirected unweighted matrix is its own transpose, otherwise the transposed bits are built into `storage`.
+    template <typename Executor>
+    const std::uint64_t* in_edge_bits(Executor& executor, std::vector<std::uint64_t>& storage, size_type& stride) const
+    {
+        if constexpr (!Directed && !Weighted)
+        {
+            stride = stride_;
+            return matrix_;
+        }
+        else
+        {
+            stride = size_ / 64 + (size_ % 64 != 0);
+            storage.assign(size_ * stride, 0);
+
+            // each chunk owns the rows of its vertices, so no two chunks write the same word
+            auto transpose = [&](size_type begin, size_type end)
+            {
+                for (V u = 0; u < size_; u++)
+                {
+                    for (V v = begin; v < end; v++)
+                    {
+                        if (weight(u, v) != NO_EDGE)
+                        {
+                            storage[v * stride + u / 64] |= std::uint64_t(1) << (u % 64);
+                        }
+                    }
+                }
+            };
+            common::parallel_chunks(executor, size_, transpose);
+            return storage.data();
+        }
+    }
+
+    // Workspace of the point-to-point queries called without one, reused by the queries of each thread.
+    static SearchWorkspace& thread_workspace()
+    {
+        static thread_local SearchWorkspace workspace;
+        return workspace;
+    }
+
+    // Call action(v) for each vertex v adjacent to vertex `to`, that is, with an edge from v to `to`.
+    // This scans a column of the matrix, one strided access per row, so prefer the row when the graph is undirected.
     template <typename F>
-    void dfs(const V& start, const F& action, std::vector<bool>& visited) const
+    void for_each_adjacent_to(V to, const F& action) const
     {
-        action(start);
-        visited[start] = true;
+        for (V v = 0; v < size_; v++)
+        {
+            if (weight(v, to) != NO_EDGE)
+            {
+                action(v);
+            }
+        }
+    }
+
+    // Return the path to vertex `to` by following the previous vertices of the labels, or an empty path if not found.
+    static std::vector<V> trace_path(const common::StampedArray<SearchWorkspace::Label>& labels, V to)
+    {
+        std::vector<V> path;
+        if (labels.get(to).dist_ != NO_EDGE)
+        {
+            for (V v = to; v != -1; v = labels.get(v).prev_)
+            {
+                path.push_back(v);
+            }
+            std::reverse(path.begin(), path.end());
+        }
+        return path;
+    }
+
+    // Queue-based Bellman-Ford (SPFA) from the vertices whose dist is not NO_EDGE, until no edge relaxes.
+    // A shortest path has less than size_ edges, so a longer one proves a negative cycle.
+    // The sums are wide, and a sum not below dist[v] <= NO_EDGE never relaxes, so a distance that would not fit in E stays NO_EDGE.
+    void spfa(std::vector<E>& dist, std::vector<V>& path) const
+    {
+        ArrayQueue<V> queue;
+        auto in_queue = std::vector<bool>(size_, false);
+        for (V v = 0; v < size_; v++)
+        {
+            if (dist[v] != NO_EDGE)
+            {
+                in_queue[v] = true;
+                queue.enqueue(v);
+            }
+        }
+
+        auto length = std::vector<size_type>(size_, 0); // number of edges of the path found to each vertex
+        auto never = [](V)
+        { return false; };
+
+        while (!queue.is_empty())
+        {
+            V u = queue.dequeue(); // only reached vertices are queued, so NO_EDGE is never added to
+            in_queue[u] = false;
+            auto relax = [&](V v)
+            {
+                long long sum = (long long)dist[u] + weight(u, v);
+                if (sum < dist[v])
+                {
+                    dist[v] = E(sum);
+                    path[v] = u;
+                    length[v] = length[u] + 1;
+                    if (length[v] >= size_)
+                    {
+                        throw std::runtime_error("Error: Cannot find shortest paths with a negative cycle.");
+                    }
+                    if (!in_queue[v])
+                    {
+                        in_queue[v] = true;
+                        queue.enqueue(v);
+                    }
+                }
+            };
+            for_each_adjacent(u, never, relax);
+        }
+    }
 
+    // Kahn's algorithm: append the vertices to order while their remaining in-degree is 0, return the number appended.
+    // Less than size_ vertices are appended if and only if the graph has a cycle.
+    size_type kahn(std::vector<V>& order) const
+    {
+        auto never = [](V)
+        { return false; };
+
+        std::vector<size_type> in_degree(size_, 0);
+        auto count_in = [&](V v)
+        { in_degree[v]++; };
+        for (V u = 0; u < size_; u++)
+        {
+            for_each_adjacent(u, never, count_in);
+        }
+
+        ArrayQueue<V> queue;
         for (V v = 0; v < size_; v++)
         {
-            if (is_adjacent(start, v) && !visited[v])
+            if (in_degree[v] == 0)
+            {
+                queue.enqueue(v);
+            }
+        }
+
+        size_type count = 0;
+        auto remove_in = [&](V v)
+        {
+            if (--in_degree[v] == 0)
+            {
+                queue.enqueue(v);
+            }
+        };
+        while (!queue.is_empty())
+        {
+            V u = queue.dequeue();
+            order.push_back(u);
+            count++;
+            for_each_adjacent(u, never, remove_in);
+        }
+        return count;
+    }
+
+    // Allocate an uninitialized matrix of the given number of cells, aligned to the cache line.
+    static Cell* allocate_matrix(size_type cells)
+    {
+        return static_cast<Cell*>(::operator new[](cells * sizeof(Cell), std::align_val_t(CACHE_LINE)));
+    }
+
+    // Free matrix memory.
+    void free_matrix()
+    {
+        if (matrix_ != nullptr)
+        {
+            ::operator delete[](matrix_, std::align_val_t(CACHE_LINE));
+        }
+    }
+
+    // Depth-first search helper, with the explicit stack of the workspace instead of recursion.
+    // The cursor of v is where the scan of the neighbors of v resumes, so each row is scanned once in total.
+    template <typename Pre, typename Post>
+    void dfs(SearchWorkspace& workspace, const V& start, const Pre& pre, const Post& post) const
+    {
+        auto& visited = workspace.visited_;
+        auto& cursor = workspace.cursor_;
+        auto& stack = workspace.stack_;
+
+        pre(start);
+        visited.set(start, true);
+        stack.push(start);
+
+        while (!stack.is_empty())
+        {
+            V u = stack.top();
+            V v = next_adjacent(u, cursor.get(u));
+            while (v < size_ && visited.is_set(v))
+            {
+                v = next_adjacent(u, v + 1);
+            }
+
+            if (v < size_)
             {
-                dfs(v, action, visited);
+                cursor.set(u, v + 1);
+                pre(v);
+                visited.set(v, true);
+                stack.push(v);
+            }
+            else
+            {
+                cursor.set(u, size_);
+                stack.pop();
+                post(u);
             }
         }
     }
 
     // Finds the vertex with the smallest distance in an unaccessed set of vertices.
-    V find_closest(std::vector<V>& dist, std::vector<bool>& visited) const
+    V find_closest(std::vector<E>& dist, std::vector<bool>& visited) const
     {
         V min_v;
         E min_dist = NO_EDGE;
@@ -102,19 +467,71 @@ public:
      */
 
     /// Create an empty graph.
-    MatrixGraph()
+    MatrixGraph() noexcept
         : common::Container(0)
+        , stride_(0)
         , matrix_(nullptr)
     {
     }
 
     /// Create a graph with n vertices.
-    MatrixGraph(int n)
+    MatrixGraph(size_type n)
         : MatrixGraph()
     {
         set_vertex_number(n);
     }
 
+    /// Create a graph by copying the vertices and edges of the given graph.
+    MatrixGraph(const MatrixGraph& that)
+        : MatrixGraph()
+    {
+        if (that.matrix_ != nullptr)
+        {
+            matrix_ = allocate_matrix(that.size_ * that.stride_);
+            std::copy(that.matrix_, that.matrix_ + that.size_ * that.stride_, matrix_);
+            size_ = that.size_;
+            stride_ = that.stride_;
+        }
+    }
+
+    /// Create a graph by taking over the matrix of the given graph, which is left empty.
+    MatrixGraph(MatrixGraph&& that) noexcept
+        : common::Container(that.size_)
+        , stride_(that.stride_)
+        , matrix_(that.matrix_)
+    {
+        that.size_ = 0;
+        that.stride_ = 0;
+        that.matrix_ = nullptr;
+    }
+
+    /// Replace the vertices and edges of the graph by a copy of those of the given graph.
+    MatrixGraph& operator=(const MatrixGraph& that)
+    {
+        if (this != &that)
+        {
+            *this = MatrixGraph(that);
+        }
+        return *this;
+    }
+
+    /// Replace the vertices and edges of the graph by taking over the matrix of the given graph, which is left empty.
+    MatrixGraph& operator=(MatrixGraph&& that) noexcept
+    {
+        if (this != &that)
+        {
+            free_matrix();
+            size_ = that.size_;
+            stride_ = that.stride_;
+            matrix_ = that.matrix_;
+
+            that.size_ = 0;
+            that.stride_ = 0;
+            that.matrix_ = nullptr;
+        }
+        return *this;
+    }
+
     /// Destroy the graph object.
     ~MatrixGraph()
     {
@@ -128,23 +545,8 @@ public:
     /// Check whether two graphs are equal.
     bool operator==(const MatrixGraph& that) const
     {
-        if (size() != that.size())
-        {
-            return false;
-        }
-
-        for (V v1 = 0; v1 < size_; v1++)
-        {
-            for (V v2 = 0; v2 < size_; v2++)
-            {
-                if (matrix_[v1][v2] != that.matrix_[v1][v2])
-                {
-                    return false;
-                }
-            }
-        }
-
-        return true;
+        // the padding is always empty, so the whole buffers can be compared
+        return size_ == that.size_ && std::equal(matrix_, matrix_ + size_ * stride_, that.matrix_);
     }
 
     /// Check whether two graphs are not equal.
@@ -163,7 +565,7 @@ public:
         common::check_bounds(from, 0, size_);
         common::check_bounds(to, 0, size_);
 
-        return matrix_[from][to];
+        return weight(from, to);
     }
 
     /// Determine if vertex `from` has a link to vertex `to`.
@@ -172,60 +574,387 @@ public:
         common::check_bounds(from, 0, size_);
         common::check_bounds(to, 0, size_);
 
-        return matrix_[from][to] != NO_EDGE;
+        return weight(from, to) != NO_EDGE;
+    }
+
+    /// Return the number of edges from vertex `from`. Unweighted rows are counted with popcount.
+    size_type out_degree(const V& from) const
+    {
+        common::check_bounds(from, 0, size_);
+
+        return count_adjacent(from);
     }
 
     /// Depth-first search graph.
     template <typename F>
     void depth_first_search(const V& start, const F& action) const
+    {
+        depth_first_search(start, action, [](const V&) {});
+    }
+
+    /// Depth-first search graph, call pre(v) when vertex v is discovered and post(v) when all its descendants are finished.
+    ///
+    /// The search is iterative, so its depth is not limited by the call stack.
+    template <typename Pre, typename Post>
+    void depth_first_search(const V& start, const Pre& pre, const Post& post) const
+    {
+        SearchWorkspace workspace;
+        depth_first_search(workspace, start, pre, post);
+    }
+
+    /// Depth-first search graph with the reusable workspace, so that repeated searches allocate nothing.
+    template <typename F>
+    void depth_first_search(SearchWorkspace& workspace, const V& start, const F& action) const
+    {
+        depth_first_search(workspace, start, action, [](const V&) {});
+    }
+
+    /// Depth-first search graph with the reusable workspace, so that repeated searches allocate nothing.
+    /// Call pre(v) when vertex v is discovered and post(v) when all its descendants are finished.
+    template <typename Pre, typename Post>
+    void depth_first_search(SearchWorkspace& workspace, const V& start, const Pre& pre, const Post& post) const
     {
         common::check_bounds(start, 0, size_);
 
-        auto visited = std::vector<bool>(size_, false);
+        workspace.reset(size_);
+        dfs(workspace, start, pre, post);
+    }
 
-        dfs(start, action, visited);
+    /// Return the strongly connected component of each vertex, numbered from 0 in topological order:
+    /// every edge between two components goes from the smaller number to the larger one.
+    ///
+    /// Tarjan's algorithm, iterative with explicit stacks, so its depth is not limited by the call stack.
+    /// For an undirected graph the components are the connected components.
+    std::vector<V> strongly_connected_components() const
+    {
+        std::vector<V> index(size_, -1); // discovery order
+        std::vector<V> low(size_);       // smallest index reachable through the DFS subtree and one more edge
+        std::vector<V> component(size_, -1);
+        std::vector<V> cursor(size_, 0);
+        ArrayStack<V> open;  // discovered vertices without a component, in discovery order
+        ArrayStack<V> calls; // the DFS path
+
+        V next_index = 0;
+        V count = 0;
+        for (V start = 0; start < size_; start++)
+        {
+            if (index[start] != -1)
+            {
+                continue;
+            }
+
+            index[start] = low[start] = next_index++;
+            open.push(start);
+            calls.push(start);
+            while (!calls.is_empty())
+            {
+                V u = calls.top();
+                V v = next_adjacent(u, cursor[u]);
+                if (v < size_)
+                {
+                    cursor[u] = v + 1;
+                    if (index[v] == -1)
+                    {
+                        index[v] = low[v] = next_index++;
+                        open.push(v);
+                        calls.push(v);
+                    }
+                    else if (component[v] == -1) // v is still open, so it is on the DFS path or in a subtree of it
+                    {
+                        low[u] = std::min(low[u], index[v]);
+                    }
+                    continue;
+                }
+
+                calls.pop();
+                if (!calls.is_empty())
+                {
+                    low[calls.top()] = std::min(low[calls.top()], low[u]);
+                }
+                if (low[u] == index[u]) // u is the root of a component, which is the open vertices from u
+                {
+                    V w;
+                    do
+                    {
+                        w = open.pop();
+                        component[w] = count;
+                    } while (w != u);
+                    count++;
+                }
+            }
+        }
+
+        // Tarjan's algorithm finds the components in reverse topological order
+        for (V v = 0; v < size_; v++)
+        {
+            component[v] = count - 1 - component[v];
+        }
+        return component;
+    }
+
+    /// Return the vertices of the directed acyclic graph in topological order: every edge goes from an earlier vertex
+    /// to a later one. Kahn's algorithm, vertices with the same depth in ascending order. Throw if the graph has a cycle.
+    std::vector<V> topological_sort() const
+    {
+        static_assert(Directed == true, "Topological sort requires a directed graph.");
+
+        std::vector<V> order;
+        order.reserve(size_);
+        if (kahn(order) != size_)
+        {
+            throw std::runtime_error("Error: Cannot sort a graph with a cycle.");
+        }
+        return order;
+    }
+
+    /// Check whether the graph has a cycle. A self-loop is a cycle, and in an undirected graph an edge and its reverse are not.
+    bool has_cycle() const
+    {
+        if constexpr (Directed)
+        {
+            std::vector<V> order;
+            order.reserve(size_);
+            return kahn(order) != size_;
+        }
+        else
+        {
+            // an edge inside a component closes a cycle
+            DisjointSet forest(size_);
+            for (V u = 0; u < size_; u++)
+            {
+                for (V v = next_adjacent(u, u); v < size_; v = next_adjacent(u, v + 1))
+                {
+                    if (v == u || !forest.unite(u, v))
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
     }
 
     /// Breadth-first search graph.
     template <typename F>
     void breadth_first_search(const V& start, const F& action) const
+    {
+        SearchWorkspace workspace;
+        breadth_first_search(workspace, start, action);
+    }
+
+    /// Breadth-first search graph with the reusable workspace, so that repeated searches allocate nothing.
+    template <typename F>
+    void breadth_first_search(SearchWorkspace& workspace, const V& start, const F& action) const
     {
         common::check_bounds(start, 0, size_);
 
-        auto visited = std::vector<bool>(size_, false);
+        workspace.reset(size_);
+        auto& visited = workspace.visited_;
+        auto& queue = workspace.queue_;
+        auto is_visited = [&](V v)
+        { return visited.is_set(v); };
 
         action(start);
-        visited[start] = true;
+        visited.set(start, true);
 
-        ArrayQueue<V> queue;
         queue.enqueue(start);
         while (!queue.is_empty())
         {
             V v1 = queue.dequeue();
-            for (V v2 = 0; v2 < size_; v2++)
+            auto visit = [&](V v2)
+            {
+                action(v2);
+                visited.set(v2, true);
+                queue.enqueue(v2);
+            };
+            for_each_adjacent(v1, is_visited, visit);
+        }
+    }
+
+    /// Breadth-first search graph level by level. Return the level and the parent of each vertex, -1 if unreachable.
+    ///
+    /// The start vertex has level 0 and parent -1. See the overload with an executor.
+    std::pair<std::vector<V>, std::vector<V>> breadth_first_levels(const V& start) const
+    {
+        common::SerialExecutor executor;
+        return breadth_first_levels(executor, start);
+    }
+
+    /// Breadth-first search graph level by level, each level in parallel on the executor (such as common::ThreadPool).
+    /// Return the level and the parent of each vertex, -1 if unreachable.
+    ///
+    /// Direction-optimizing: a top-down step scans the out-edges of the frontier, a bottom-up step scans the in-edges
+    /// of each unvisited vertex until it finds one from the frontier, which is cheaper once the frontier is large.
+    /// The frontiers and the visited set are bitmaps. The levels are deterministic, but with more than one thread
+    /// a vertex may get any of its parents on the previous level.
+    template <typename Executor>
+    std::pair<std::vector<V>, std::vector<V>> breadth_first_levels(Executor& executor, const V& start) const
+    {
+        common::check_bounds(start, 0, size_);
+
+        using Word = std::uint64_t;
+        const size_type words = size_ / 64 + (size_ % 64 != 0);
+
+        std::vector<V> level(size_, -1);
+        std::vector<V> parent(size_, -1);
+        std::vector<std::atomic<Word>> visited(words);
+        std::vector<std::atomic<Word>> frontier(words);
+        std::vector<std::atomic<Word>> next(words);
+        std::vector<V> frontier_list;
+
+        std::vector<size_type> degree(size_);
+        auto count_degrees = [&](size_type begin, size_type end)
+        {
+            for (V v = begin; v < end; v++)
+            {
+                degree[v] = count_adjacent(v);
+            }
+        };
+        common::parallel_chunks(executor, size_, count_degrees);
+
+        size_type unexplored_edges = 0; // edges from the unvisited vertices
+        for (V v = 0; v < size_; v++)
+        {
+            unexplored_edges += degree[v];
+        }
+
+        level[start] = 0;
+        visited[start / 64] = Word(1) << (start % 64);
+        frontier[start / 64] = Word(1) << (start % 64);
+        size_type frontier_size = 1;
+        size_type frontier_edges = degree[start];
+        unexplored_edges -= degree[start];
+
+        std::vector<Word> in_storage;
+        const Word* in_bits = nullptr;
+        size_type in_stride = 0;
+
+        bool bottom_up = false;
+        for (V depth = 1; frontier_size > 0; depth++)
+        {
+            if (!bottom_up && frontier_edges > unexplored_edges / BFS_ALPHA)
+            {
+                bottom_up = true;
+                if (in_bits == nullptr)
+                {
+                    in_bits = in_edge_bits(executor, in_storage, in_stride);
+                }
+            }
+            else if (bottom_up && frontier_size < size_ / BFS_BETA)
+            {
+                bottom_up = false;
+            }
+
+            std::atomic<size_type> next_size(0);
+            std::atomic<size_type> next_edges(0);
+
+            if (bottom_up)
+            {
+                // each chunk owns whole words of vertices, so it alone writes their visited and next bits
+                auto step_bottom_up = [&](size_type begin, size_type end)
+                {
+                    size_type count = 0, edges = 0;
+                    for (size_type w = begin; w < end; w++)
+                    {
+                        Word found = 0;
+                        Word unvisited = ~visited[w].load(std::memory_order_relaxed);
+                        for (; unvisited != 0; unvisited &= unvisited - 1)
+                        {
+                            V v = w * 64 + lowest_bit(unvisited);
+                            if (v >= size_)
+                            {
+                                break;
+                            }
+                            const Word* in = in_bits + v * in_stride;
+                            for (size_type i = 0; i < words; i++)
+                            {
+                                Word hit = in[i] & frontier[i].load(std::memory_order_relaxed);
+                                if (hit != 0)
+                                {
+                                    parent[v] = i * 64 + lowest_bit(hit);
+                                    level[v] = depth;
+                                    found |= Word(1) << (v % 64);
+                                    count++;
+                                    edges += degree[v];
+                                    break;
+                                }
+                            }
+                        }
+                        visited[w].fetch_or(found, std::memory_order_relaxed);
+                        next[w].store(found, std::memory_order_relaxed);
+                    }
+                    next_size += count;
+                    next_edges += edges;
+                };
+                common::parallel_chunks(executor, words, step_bottom_up);
+            }
+            else
             {
-                if (!visited[v2] && is_adjacent(v1, v2))
+                frontier_list.clear();
+                for (size_type w = 0; w < words; w++)
                 {
-                    action(v2);
-                    visited[v2] = true;
-                    queue.enqueue(v2);
+                    for (Word word = frontier[w].load(std::memory_order_relaxed); word != 0; word &= word - 1)
+                    {
+                        frontier_list.push_back(w * 64 + lowest_bit(word));
+                    }
                 }
+
+                // a vertex is claimed by whichever chunk sets its visited bit first
+                auto step_top_down = [&](size_type begin, size_type end)
+                {
+                    size_type count = 0, edges = 0;
+                    auto is_visited = [&](V v)
+                    { return (visited[v / 64].load(std::memory_order_relaxed) >> (v % 64) & 1) != 0; };
+                    for (size_type i = begin; i < end; i++)
+                    {
+                        V u = frontier_list[i];
+                        auto claim = [&](V v)
+                        {
+                            Word bit = Word(1) << (v % 64);
+                            if ((visited[v / 64].fetch_or(bit, std::memory_order_relaxed) & bit) == 0)
+                            {
+                                parent[v] = u;
+                                level[v] = depth;
+                                next[v / 64].fetch_or(bit, std::memory_order_relaxed);
+                                count++;
+                                edges += degree[v];
+                            }
+                        };
+                        for_each_adjacent(u, is_visited, claim);
+                    }
+                    next_size += count;
+                    next_edges += edges;
+                };
+                common::parallel_chunks(executor, size_type(frontier_list.size()), step_top_down);
             }
+
+            frontier.swap(next);
+            for (size_type w = 0; w < words; w++)
+            {
+                next[w].store(0, std::memory_order_relaxed);
+            }
+            frontier_size = next_size;
+            frontier_edges = next_edges;
+            unexplored_edges -= frontier_edges;
         }
+
+        return {level, parent};
     }
 
     /// The Dijkstra algorithm on the graph. Return distance and path.
+    ///
+    /// As for all_pairs_shortest_paths(), a distance that would not fit in E saturates to NO_EDGE.
     std::pair<std::vector<E>, std::vector<V>> dijkstra(const V& start) const
     {
         common::check_bounds(start, 0, size_);
 
         // init state
         auto visited = std::vector<bool>(size_, false);
-        std::vector<V> dist(size_);
+        std::vector<E> dist(size_);
         std::vector<V> path(size_);
         for (V v = 0; v < size_; v++)
         {
-            dist[v] = matrix_[start][v];
+            dist[v] = weight(start, v);
             path[v] = dist[v] < NO_EDGE ? start : -1;
         }
 
@@ -242,15 +971,17 @@ public:
             visited[v1] = true;
             for (V v2 = 0; v2 < size_; v2++)
             {
-                if (!visited[v2] && matrix_[v1][v2] < NO_EDGE)
+                E w = weight(v1, v2);
+                if (!visited[v2] && w < NO_EDGE)
                 {
-                    if (matrix_[v1][v2] < 0)
+                    if (w < 0)
                     {
                         throw std::runtime_error("Error: Cannot apply Dijkstra algorithm with a negative weighted egde.");
                     }
-                    if (dist[v1] + matrix_[v1][v2] < dist[v2])
+                    long long sum = (long long)dist[v1] + w; // dist[v2] is at most NO_EDGE, so a sum that relaxes fits in E
+                    if (sum < dist[v2])
                     {
-                        dist[v2] = dist[v1] + matrix_[v1][v2];
+                        dist[v2] = E(sum);
                         path[v2] = v1;
                     }
                 }
@@ -260,49 +991,562 @@ public:
         return {dist, path};
     }
 
-    /*
-     * Manipulation
-     */
+    /// All-pairs shortest paths on the graph. Return distance and path, where dist[u] and path[u] are as for dijkstra(u).
+    ///
+    /// Unlike dijkstra(), negative weights are allowed. See the overload with an executor.
+    std::pair<std::vector<std::vector<E>>, std::vector<std::vector<V>>> all_pairs_shortest_paths() const
+    {
+        common::SerialExecutor executor;
+        return all_pairs_shortest_paths(executor);
+    }
 
-    /// Set the number of vertices in the graph.
-    void set_vertex_number(int n)
+    /// All-pairs shortest paths on the graph, in parallel on the executor (such as common::ThreadPool).
+    /// Return distance and path, where dist[u] and path[u] are as for dijkstra(u).
+    ///
+    /// Blocked Floyd-Warshall: the matrix is relaxed in cache-sized tiles by SIMD min-plus kernels, the independent tiles
+    /// of each round in parallel. Sums through NO_EDGE are never taken, and a distance that would not fit in E saturates to NO_EDGE.
+    /// Throw if the graph has a negative cycle.
+    template <typename Executor>
+    std::pair<std::vector<std::vector<E>>, std::vector<std::vector<V>>> all_pairs_shortest_paths(Executor& executor) const
     {
-        free_matrix();
+        // the vertices fit in E, a matrix of more than INT_MAX vertices could never be allocated
+        std::vector<E> dist(size_ * size_);
+        std::vector<E> via(size_ * size_);
+        for (V u = 0; u < size_; u++)
+        {
+            for (V v = 0; v < size_; v++)
+            {
+                dist[u * size_ + v] = weight(u, v);
+                via[u * size_ + v] = dist[u * size_ + v] < NO_EDGE ? E(u) : -1;
+            }
+            dist[u * size_ + u] = std::min(dist[u * size_ + u], 0);
+            via[u * size_ + u] = -1;
+        }
 
-        size_ = n;
+        common::floyd_warshall(executor, dist.data(), via.data(), size_);
 
-        matrix_ = new E*[n];
-        for (int i = 0; i < n; i++)
+        std::vector<std::vector<E>> all_dist(size_);
+        std::vector<std::vector<V>> all_path(size_);
+        for (V u = 0; u < size_; u++)
         {
-            matrix_[i] = new E[n];
+            if (dist[u * size_ + u] < 0)
+            {
+                throw std::runtime_error("Error: Cannot find shortest paths with a negative cycle.");
+            }
+            all_dist[u].assign(dist.begin() + u * size_, dist.begin() + (u + 1) * size_);
+            all_path[u].assign(via.begin() + u * size_, via.begin() + (u + 1) * size_);
         }
 
-        for (V v1 = 0; v1 < n; v1++)
+        return {all_dist, all_path};
+    }
+
+    /// The Dijkstra algorithm on the graph with the reusable workspace, so that repeated searches allocate nothing.
+    /// The distance and the path are left in the workspace, see SearchWorkspace::distance() and SearchWorkspace::previous().
+    ///
+    /// Heap-based over epoch-stamped labels, so that a search costs only the vertices it reaches.
+    void dijkstra(SearchWorkspace& workspace, const V& start) const
+    {
+        common::check_bounds(start, 0, size_);
+
+        workspace.reset(size_);
+        auto& labels = workspace.labels_[0];
+        auto& heap = workspace.heaps_[0];
+        labels.set(start, {0, -1});
+        heap.push({0, 0, start});
+
+        auto never = [](V)
+        { return false; };
+        while (!heap.is_empty())
         {
-            for (V v2 = 0; v2 < n; v2++)
+            auto [key, d, u] = heap.pop();
+            if (d > labels.get(u).dist_)
             {
-                matrix_[v1][v2] = NO_EDGE;
+                continue; // outdated entry, u was pushed again with a shorter distance
             }
+            auto relax = [&](V v)
+            {
+                E w = weight(u, v);
+                if (w < 0)
+                {
+                    throw std::runtime_error("Error: Cannot apply Dijkstra algorithm with a negative weighted egde.");
+                }
+                long long sum = (long long)d + w; // labels are at most NO_EDGE, so a sum that relaxes fits in E
+                if (sum < labels.get(v).dist_)
+                {
+                    labels.set(v, {E(sum), u});
+                    heap.push({sum, E(sum), v});
+                }
+            };
+            for_each_adjacent(u, never, relax);
         }
     }
 
-    /// Link vertex `from` and vertex `to` with `weight`.
-    void link(const V& from, const V& to, const E& weight)
+    /// The A* algorithm on the graph. Return the distance from vertex `start` to vertex `goal` and the vertices of a shortest path,
+    /// or NO_EDGE and an empty path if the goal is unreachable or its distance would not fit in E.
+    ///
+    /// heuristic(v) estimates the distance from vertex v to the goal and must never overestimate it.
+    /// The search stops once the goal is settled. The labels are epoch-stamped arrays in a workspace reused by the queries
+    /// of the calling thread, so a query costs only the vertices it reaches. Throw if it meets a negative weighted edge.
+    template <typename H>
+    std::pair<E, std::vector<V>> astar(const V& start, const V& goal, const H& heuristic) const
+    {
+        return astar(thread_workspace(), start, goal, heuristic);
+    }
+
+    /// The A* algorithm on the graph with the reusable workspace. See the overload without a workspace.
+    template <typename H>
+    std::pair<E, std::vector<V>> astar(SearchWorkspace& workspace, const V& start, const V& goal, const H& heuristic) const
+    {
+        common::check_bounds(start, 0, size_);
+        common::check_bounds(goal, 0, size_);
+
+        workspace.reset(size_);
+        auto& labels = workspace.labels_[0];
+        auto& heap = workspace.heaps_[0]; // entries of estimated total, distance, vertex
+        labels.set(start, {0, -1});
+        heap.push({heuristic(start), 0, start});
+
+        auto never = [](V)
+        { return false; };
+        while (!heap.is_empty())
+        {
+            auto [estimate, d, u] = heap.pop();
+            if (d > labels.get(u).dist_)
+            {
+                continue; // outdated entry, u was pushed again with a shorter distance
+            }
+            if (u == goal)
+            {
+                break;
+            }
+            auto relax = [&](V v)
+            {
+                E w = weight(u, v);
+                if (w < 0)
+                {
+                    throw std::runtime_error("Error: Cannot apply Dijkstra algorithm with a negative weighted egde.");
+                }
+                long long sum = (long long)d + w; // labels are at most NO_EDGE, so a sum that relaxes fits in E
+                if (sum < labels.get(v).dist_)
+                {
+                    labels.set(v, {E(sum), u});
+                    heap.push({sum + heuristic(v), E(sum), v});
+                }
+            };
+            for_each_adjacent(u, never, relax);
+        }
+
+        return {labels.get(goal).dist_, trace_path(labels, goal)};
+    }
+
+    /// The bidirectional Dijkstra algorithm on the graph. Return the distance from vertex `start` to vertex `goal`
+    /// and the vertices of a shortest path, or NO_EDGE and an empty path if the goal is unreachable or its distance would not fit in E.
+    ///
+    /// One search runs forward from the start and one backward from the goal, always the one with the closer frontier,
+    /// until no path through their frontiers can beat the shortest path found between them. The labels are epoch-stamped
+    /// arrays in a workspace reused by the queries of the calling thread. Throw if it meets a negative weighted edge.
+    ///
+    /// In an undirected graph both searches scan rows. In a directed graph the backward search follows the incoming edges,
+    /// which scans a column of the matrix with one strided access per row, so each vertex it settles costs more than a forward one.
+    std::pair<E, std::vector<V>> bidirectional_dijkstra(const V& start, const V& goal) const
+    {
+        return bidirectional_dijkstra(thread_workspace(), start, goal);
+    }
+
+    /// The bidirectional Dijkstra algorithm on the graph with the reusable workspace. See the overload without a workspace.
+    std::pair<E, std::vector<V>> bidirectional_dijkstra(SearchWorkspace& workspace, const V& start, const V& goal) const
+    {
+        common::check_bounds(start, 0, size_);
+        common::check_bounds(goal, 0, size_);
+
+        workspace.reset(size_);
+        auto& forward = workspace.labels_[0];
+        auto& backward = workspace.labels_[1];
+        auto& forward_heap = workspace.heaps_[0]; // entries of distance, distance, vertex
+        auto& backward_heap = workspace.heaps_[1];
+        forward.set(start, {0, -1});
+        backward.set(goal, {0, -1});
+        forward_heap.push({0, 0, start});
+        backward_heap.push({0, 0, goal});
+
+        long long best = start == goal ? 0 : LLONG_MAX;
+        V meet = start;
+
+        // relax the edge between u and v with weight w in the direction of the labels
+        auto relax = [&](auto& labels, const auto& other, auto& heap, E d, V u, V v, E w)
+        {
+            if (w < 0)
+            {
+                throw std::runtime_error("Error: Cannot apply Dijkstra algorithm with a negative weighted egde.");
+            }
+            long long sum = (long long)d + w; // labels are at most NO_EDGE, so a sum that relaxes fits in E
+            if (sum < labels.get(v).dist_)
+            {
+                labels.set(v, {E(sum), u});
+                heap.push({sum, E(sum), v});
+                if (other.get(v).dist_ != NO_EDGE && sum + other.get(v).dist_ < best)
+                {
+                    best = sum + other.get(v).dist_;
+                    meet = v;
+                }
+            }
+        };
+
+        auto never = [](V)
+        { return false; };
+        while (!forward_heap.is_empty() && !backward_heap.is_empty()
+               && std::get<0>(forward_heap.peek()) + std::get<0>(backward_heap.peek()) < best)
+        {
+            if (std::get<0>(forward_heap.peek()) <= std::get<0>(backward_heap.peek()))
+            {
+                auto [key, d, u] = forward_heap.pop();
+                if (d == forward.get(u).dist_)
+                {
+                    auto relax_out = [&](V v)
+                    { relax(forward, backward, forward_heap, d, u, v, weight(u, v)); };
+                    for_each_adjacent(u, never, relax_out);
+                }
+            }
+            else
+            {
+                auto [key, d, u] = backward_heap.pop();
+                if (d == backward.get(u).dist_)
+                {
+                    auto relax_in = [&](V v)
+                    { relax(backward, forward, backward_heap, d, u, v, weight(v, u)); };
+                    if constexpr (Directed)
+                    {
+                        for_each_adjacent_to(u, relax_in);
+                    }
+                    else
+                    {
+                        for_each_adjacent(u, never, relax_in); // the matrix is symmetric, so scan the contiguous row
+                    }
+                }
+            }
+        }
+
+        if (best >= NO_EDGE)
+        {
+            return {NO_EDGE, {}}; // unreachable, or too far for E
+        }
+
+        // the forward path to the meeting vertex, then the backward labels lead on to the goal
+        std::vector<V> path = trace_path(forward, meet);
+        for (V v = backward.get(meet).prev_; v != -1; v = backward.get(v).prev_)
+        {
+            path.push_back(v);
+        }
+        return {E(best), path};
+    }
+
+    /// The Bellman-Ford algorithm on the graph, queue-based (SPFA). Return distance and path as dijkstra().
+    ///
+    /// Unlike dijkstra(), negative weights are allowed. Throw if a negative cycle is reachable from the start.
+    /// As for all_pairs_shortest_paths(), a distance that would not fit in E saturates to NO_EDGE.
+    std::pair<std::vector<E>, std::vector<V>> bellman_ford(const V& start) const
+    {
+        common::check_bounds(start, 0, size_);
+
+        std::vector<E> dist(size_, NO_EDGE);
+        std::vector<V> path(size_, -1);
+        dist[start] = 0;
+
+        spfa(dist, path);
+
+        return {dist, path};
+    }
+
+    /// All-pairs shortest paths on the graph by Johnson's algorithm. Return distance and path as all_pairs_shortest_paths().
+    ///
+    /// See the overload with an executor.
+    std::pair<std::vector<std::vector<E>>, std::vector<std::vector<V>>> johnson() const
+    {
+        common::SerialExecutor executor;
+        return johnson(executor);
+    }
+
+    /// All-pairs shortest paths on the graph by Johnson's algorithm, the sources in parallel on the executor (such as common::ThreadPool).
+    /// Return distance and path as all_pairs_shortest_paths().
+    ///
+    /// One Bellman-Ford pass finds potentials h that make every weight w(u, v) + h[u] - h[v] non-negative,
+    /// then a binary heap Dijkstra runs from each vertex over edge lists extracted from the matrix once.
+    /// On a sparse graph that is O(V^2 + V E log V) instead of the O(V^3) of Floyd-Warshall.
+    /// The distances are computed in long long, and one that would not fit in E saturates to NO_EDGE with no path,
+    /// as in all_pairs_shortest_paths(). Throw if the graph has a negative cycle.
+    template <typename Executor>
+    std::pair<std::vector<std::vector<E>>, std::vector<std::vector<V>>> johnson(Executor& executor) const
+    {
+        // potentials: distances from a virtual vertex linked to every vertex by 0
+        std::vector<E> h(size_, 0);
+        std::vector<V> h_path(size_, -1);
+        spfa(h, h_path);
+
+        // edge lists with the reweighted weights, wide enough for any weight plus a difference of potentials
+        std::vector<size_type> offset(size_ + 1, 0);
+        std::vector<V> target;
+        std::vector<long long> reweight;
+        auto never = [](V)
+        { return false; };
+        for (V u = 0; u < size_; u++)
+        {
+            auto add_edge = [&](V v)
+            {
+                target.push_back(v);
+                reweight.push_back((long long)weight(u, v) + h[u] - h[v]);
+            };
+            for_each_adjacent(u, never, add_edge);
+            offset[u + 1] = size_type(target.size());
+        }
+
+        std::vector<std::vector<E>> all_dist(size_, std::vector<E>(size_, NO_EDGE));
+        std::vector<std::vector<V>> all_path(size_, std::vector<V>(size_, -1));
+
+        auto dijkstra_sources = [&](size_type begin, size_type end)
+        {
+            using Entry = std::pair<long long, V>;
+            std::vector<long long> dist(size_);
+            for (V s = begin; s < end; s++)
+            {
+                std::vector<V>& path = all_path[s];
+                std::fill(dist.begin(), dist.end(), LLONG_MAX);
+                dist[s] = 0;
+
+                BinaryHeap<Entry, std::less<Entry>> heap;
+                heap.push({0, s});
+                while (!heap.is_empty())
+                {
+                    auto [d, u] = heap.pop();
+                    if (d > dist[u])
+                    {
+                        continue; // outdated entry, u was pushed again with a shorter distance
+                    }
+                    for (size_type i = offset[u]; i < offset[u + 1]; i++)
+                    {
+                        V v = target[i];
+                        if (d + reweight[i] < dist[v])
+                        {
+                            dist[v] = d + reweight[i];
+                            path[v] = u;
+                            heap.push({dist[v], v});
+                        }
+                    }
+                }
+
+                for (V v = 0; v < size_; v++)
+                {
+                    long long d = dist[v] == LLONG_MAX ? LLONG_MAX : dist[v] - h[s] + h[v];
+                    if (d < NO_EDGE)
+                    {
+                        all_dist[s][v] = E(d);
+                    }
+                    else
+                    {
+                        path[v] = -1; // saturated to no edge
+                    }
+                }
+            }
+        };
+        common::parallel_chunks(executor, size_, dijkstra_sources);
+
+        return {all_dist, all_path};
+    }
+
+    /// The Prim algorithm on the undirected graph. Return the total weight and the edges (u, v), u < v, of a minimum spanning tree.
+    ///
+    /// The total is a long long, since the sum of the weights may not fit in E.
+    /// A disconnected graph gets a minimum spanning forest. Dense O(V^2): the next vertex is the closest by a linear scan.
+    std::pair<long long, std::vector<std::pair<V, V>>> prim() const
+    {
+        static_assert(Directed == false, "Minimum spanning tree requires an undirected graph.");
+
+        auto in_tree = std::vector<bool>(size_, false);
+        auto is_in_tree = [&](V v)
+        { return in_tree[v]; };
+        std::vector<E> dist(size_, NO_EDGE); // weight of the lightest edge to the tree
+        std::vector<V> link_to(size_, -1);
+
+        long long total = 0; // the sum of the edge weights may not fit in E
+        std::vector<std::pair<V, V>> edges;
+        for (size_type count = 0; count < size_; count++)
+        {
+            // the closest vertex, or the first vertex of the next component if none is reachable
+            V u = -1;
+            for (V v = 0; v < size_; v++)
+            {
+                if (!in_tree[v] && (u == -1 || dist[v] < dist[u]))
+                {
+                    u = v;
+                }
+            }
+
+            in_tree[u] = true;
+            if (link_to[u] != -1)
+            {
+                total += dist[u];
+                edges.push_back({std::min(u, link_to[u]), std::max(u, link_to[u])});
+            }
+
+            auto update = [&](V v)
+            {
+                if (weight(u, v) < dist[v])
+                {
+                    dist[v] = weight(u, v);
+                    link_to[v] = u;
+                }
+            };
+            for_each_adjacent(u, is_in_tree, update);
+        }
+
+        return {total, edges};
+    }
+
+    /// The Kruskal algorithm on the undirected graph. Return the total weight and the edges (u, v), u < v, of a minimum spanning tree.
+    ///
+    /// A disconnected graph gets a minimum spanning forest. The edges are taken in ascending order of weight
+    /// unless a DisjointSet shows that they would close a cycle.
+    std::pair<long long, std::vector<std::pair<V, V>>> kruskal() const
+    {
+        static_assert(Directed == false, "Minimum spanning tree requires an undirected graph.");
+
+        std::vector<std::tuple<E, V, V>> sorted;
+        for (V u = 0; u < size_; u++)
+        {
+            auto is_before = [&](V v)
+            { return v <= u; };
+            auto add_edge = [&](V v)
+            { sorted.push_back({weight(u, v), u, v}); };
+            for_each_adjacent(u, is_before, add_edge);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        DisjointSet forest(size_);
+        long long total = 0; // the sum of the edge weights may not fit in E
+        std::vector<std::pair<V, V>> edges;
+        for (const auto& [w, u, v] : sorted)
+        {
+            if (forest.unite(u, v))
+            {
+                total += w;
+                edges.push_back({u, v});
+            }
+        }
+
+        return {total, edges};
+    }
+
+    /// The Boruvka algorithm on the undirected graph. Return the total weight and the edges (u, v), u < v, of a minimum spanning tree.
+    ///
+    /// See the overload with an executor.
+    std::pair<long long, std::vector<std::pair<V, V>>> boruvka() const
+    {
+        common::SerialExecutor executor;
+        return boruvka(executor);
+    }
+
+    /// The Boruvka algorithm on the undirected graph, in parallel on the executor (such as common::ThreadPool).
+    /// Return the total weight and the edges (u, v), u < v, of a minimum spanning tree.
+    ///
+    /// A disconnected graph gets a minimum spanning forest. Each round every component takes its lightest edge
+    /// to another component, so there are at most log V rounds, and the rows are scanned in parallel.
+    /// Ties of weight are broken by the vertices, so the taken edges never close a cycle.
+    template <typename Executor>
+    std::pair<long long, std::vector<std::pair<V, V>>> boruvka(Executor& executor) const
+    {
+        static_assert(Directed == false, "Minimum spanning tree requires an undirected graph.");
+
+        using Edge = std::tuple<E, V, V>;
+        const Edge none = {NO_EDGE, size_, size_};
+
+        DisjointSet forest(size_);
+        std::vector<V> component(size_);
+        std::vector<Edge> lightest(size_);
+
+        long long total = 0; // the sum of the edge weights may not fit in E
+        std::vector<std::pair<V, V>> edges;
+        for (bool merged = true; merged;)
+        {
+            for (V v = 0; v < size_; v++)
+            {
+                component[v] = forest.find(v);
+            }
+
+            // the lightest edge of each vertex to another component
+            auto scan_rows = [&](size_type begin, size_type end)
+            {
+                for (V u = begin; u < end; u++)
+                {
+                    Edge best = none;
+                    auto is_same_component = [&](V v)
+                    { return component[v] == component[u]; };
+                    auto compare = [&](V v)
+                    { best = std::min(best, Edge{weight(u, v), std::min(u, v), std::max(u, v)}); };
+                    for_each_adjacent(u, is_same_component, compare);
+                    lightest[u] = best;
+                }
+            };
+            common::parallel_chunks(executor, size_, scan_rows);
+
+            // the lightest edge of each component, gathered at its root
+            for (V v = 0; v < size_; v++)
+            {
+                lightest[component[v]] = std::min(lightest[component[v]], lightest[v]);
+            }
+
+            merged = false;
+            for (V v = 0; v < size_; v++)
+            {
+                const auto& [w, a, b] = lightest[v];
+                if (component[v] == v && w != NO_EDGE && forest.unite(a, b))
+                {
+                    total += w;
+                    edges.push_back({a, b});
+                    merged = true;
+                }
+            }
+        }
+
+        return {total, edges};
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Set the number of vertices in the graph.
+    void set_vertex_number(size_type n)
+    {
+        // round each row up to whole cache lines
+        size_type cells = Weighted ? n : n / 64 + (n % 64 != 0);
+        size_type stride = (cells + LINE_CELLS - 1) / LINE_CELLS * LINE_CELLS;
+
+        // allocate first, so that the graph is left unchanged if the allocation throws
+        Cell* matrix = allocate_matrix(n * stride);
+        std::fill(matrix, matrix + n * stride, empty_cell());
+
+        free_matrix();
+        size_ = n;
+        stride_ = stride;
+        matrix_ = matrix;
+    }
+
+    /// Link vertex `from` and vertex `to` with `weight`. The weight is ignored by an unweighted graph.
+    void link(const V& from, const V& to, const E& weight = 1)
     {
-        matrix_[from][to] = weight;
+        set_edge(from, to, weight);
         if constexpr (Directed == false)
         {
-            matrix_[to][from] = weight;
+            set_edge(to, from, weight);
         }
     }
 
     /// Disconnect the link from vertex `from` to vertex `to`.
     void unlink(const V& from, const V& to)
     {
-        matrix_[from][to] = NO_EDGE;
+        set_edge(from, to, NO_EDGE);
         if constexpr (Directed == false)
         {
-            matrix_[to][from] = NO_EDGE;
+            set_edge(to, from, NO_EDGE);
         }
     }
 
@@ -313,6 +1557,7 @@ public:
         {
             free_matrix();
             size_ = 0;
+            stride_ = 0;
             matrix_ = nullptr;
         }
     }
@@ -0,0 +1,134 @@
+/**
+ * @file SearchWorkspace.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Reusable state of the graph searches, so that repeated searches allocate nothing.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEARCHWORKSPACE_HPP
+#define SEARCHWORKSPACE_HPP
+
+#include "../common/Container.hpp"
+#include "../common/StampedArray.hpp"
+#include "../common/utility.hpp"
+
+#include "../Heap/BinaryHeap.hpp"
+#include "../Queue/ArrayQueue.hpp"
+#include "../Stack/ArrayStack.hpp"
+
+#include <climits> // INT_MAX
+#include <tuple>   // std::tuple
+
+namespace hellods
+{
+
+template <bool Directed, bool Weighted>
+class MatrixGraph;
+
+/// Reusable state of the graph searches: visited marks, distance labels, queue, stack and heap.
+///
+/// Pass the same workspace to many searches, on any graphs, and after the first ones have grown its buffers
+/// the searches allocate nothing: the marks and labels are cleared in constant time by starting a new generation.
+/// A workspace must not be used by two searches at once, including a search started from the callback of another.
+class SearchWorkspace
+{
+private:
+    template <bool Directed, bool Weighted>
+    friend class MatrixGraph;
+
+    using V = common::Container::size_type;
+    using E = int;
+
+    // Distance and previous vertex of a vertex found by a search.
+    struct Label
+    {
+        E dist_;
+        V prev_;
+    };
+
+    // Entry of a heap: key, distance, vertex.
+    using Entry = std::tuple<long long, E, V>;
+
+    // Visited marks, a vertex is visited if it is set in the current generation.
+    common::StampedArray<bool> visited_;
+
+    // Where the scan of the neighbors of each vertex resumes in a depth-first search.
+    common::StampedArray<V> cursor_;
+
+    // Distance labels, forward and backward.
+    common::StampedArray<Label> labels_[2];
+
+    // Queue of the breadth-first search.
+    ArrayQueue<V> queue_;
+
+    // Stack of the depth-first search.
+    ArrayStack<V> stack_;
+
+    // Heaps of the shortest path searches, forward and backward.
+    BinaryHeap<Entry, std::less<Entry>> heaps_[2];
+
+    // Number of vertices of the last search.
+    V vertex_count_;
+
+    // Start a new generation of marks and labels for n vertices, and empty the containers.
+    void reset(V n)
+    {
+        vertex_count_ = n;
+        visited_.reset(n, false);
+        cursor_.reset(n, 0);
+        labels_[0].reset(n, {INT_MAX, -1});
+        labels_[1].reset(n, {INT_MAX, -1});
+        queue_.clear();
+        stack_.clear();
+        heaps_[0].clear();
+        heaps_[1].clear();
+    }
+
+public:
+    /// Create an empty workspace, its buffers grow with the first searches.
+    SearchWorkspace()
+        : vertex_count_(0)
+    {
+    }
+
+    /// A workspace is always passed by reference, so it cannot be copied.
+    SearchWorkspace(const SearchWorkspace&) = delete;
+
+    /// A workspace is always passed by reference, so it cannot be copied.
+    SearchWorkspace& operator=(const SearchWorkspace&) = delete;
+
+    /// Return the distance to vertex v found by the last shortest path search with this workspace, NO_EDGE if not found.
+    E distance(V v) const
+    {
+        common::check_bounds(v, 0, vertex_count_);
+
+        return labels_[0].get(v).dist_;
+    }
+
+    /// Return the vertex before vertex v on the path found by the last shortest path search with this workspace, -1 if none.
+    V previous(V v) const
+    {
+        common::check_bounds(v, 0, vertex_count_);
+
+        return labels_[0].get(v).prev_;
+    }
+};
+
+} // namespace hellods
+
+#endif // SEARCHWORKSPACE_HPP
@@ -35,12 +35,12 @@ class BinaryHeap : private ArrayList<T>
 {
 private:
     // Adjust an element: process down.
-    void proc_down(int index)
+    void proc_down(size_type index)
     {
         while (index * 2 + 1 < size_ && Cmp()(data_[index * 2 + 1], data_[index]) || index * 2 + 2 < size_ && Cmp()(data_[index * 2 + 2], data_[index]))
         {
-            // if size is even then only have left node, short to avoid subscript out of bounds
-            bool is_left_max = (size_ % 2 == 0) || Cmp()(data_[index * 2 + 1], data_[index * 2 + 2]);
+            // if there is no right child then take the left one, short to avoid subscript out of bounds
+            bool is_left_max = index * 2 + 2 >= size_ || Cmp()(data_[index * 2 + 1], data_[index * 2 + 2]);
             std::swap(data_[index], is_left_max ? data_[index * 2 + 1] : data_[index * 2 + 2]);
             index = index * 2 + (is_left_max ? 1 : 2);
         }
@@ -52,7 +52,7 @@ public:
      */
 
     /// Create an empty heap.
-    BinaryHeap()
+    BinaryHeap() noexcept
         : ArrayList()
     {
     }
@@ -62,7 +62,7 @@ public:
         : ArrayList(il)
     {
         // build heap
-        for (int i = (size_ - 1) / 2; i >= 0; i--)
+        for (size_type i = (size_ - 1) / 2; i >= 0; i--)
         {
             proc_down(i);
         }
@@ -81,11 +81,11 @@ public:
         }
 
         // count elements in each heap
-        HashMap<T, int> this_map, that_map;
-        for (int i = 0; i < size(); i++)
+        HashMap<T, size_type> this_map, that_map;
+        for (size_type i = 0; i < size(); i++)
         {
-            this_map.contains(data_[i]) ? ++this_map[data_[i]] : this_map.insert(data_[i], 1);
-            that_map.contains(that.data_[i]) ? ++that_map[that.data_[i]] : that_map.insert(that.data_[i], 1);
+            ++this_map.find_or_insert(data_[i]);
+            ++that_map.find_or_insert(that.data_[i]);
         }
 
         return this_map == that_map;
@@ -102,7 +102,7 @@ public:
      */
 
     /// Get the number of elements of the heap.
-    int size() const
+    size_type size() const
     {
         return ArrayList::size();
     }
@@ -135,10 +135,10 @@ public:
             expand_capacity();
         }
 
-        int pos;
-        for (pos = size_++; pos != 0 && Cmp()(element, data_[pos / 2]); pos /= 2)
+        size_type pos;
+        for (pos = size_++; pos != 0 && Cmp()(element, data_[(pos - 1) / 2]); pos = (pos - 1) / 2)
         {
-            data_[pos] = data_[pos / 2];
+            data_[pos] = data_[(pos - 1) / 2];
         }
         data_[pos] = element;
     }
@@ -24,13 +24,24 @@
 #define ARRAYLIST_HPP
 
 #include "../common/Container.hpp"
+#include "../common/policy.hpp"
+#include "../common/search.hpp"
+#include "../common/sort.hpp"
 #include "../common/utility.hpp"
 
+#include <atomic>   // std::atomic
+#include <cstring>  // std::memmove
+#include <iterator> // std::random_access_iterator_tag
+#include <memory>   // std::addressof std::unique_ptr
+
 namespace hellods
 {
 
 /// List implemented by array.
-template <typename T>
+///
+/// The shrink policy (such as common::QuarterShrink) decides whether removals release memory automatically,
+/// and the growth policy (such as common::HalfGrowth) decides how much the capacity grows when it runs out.
+template <typename T, typename Shrink = common::NoShrink, typename Growth = common::DoubleGrowth>
 class ArrayList : public common::Container
 {
 public:
@@ -50,12 +61,22 @@ public:
         }
 
     public:
-        using iterator_category = std::input_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+#ifdef __cpp_lib_concepts
+        using iterator_concept = std::contiguous_iterator_tag;
+#endif
         using value_type = T;
-        using difference_type = int;
+        using element_type = T;
+        using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
 
+        /// Create a singular iterator.
+        Iterator()
+            : current_(nullptr)
+        {
+        }
+
         /// Dereference.
         T& operator*() const
         {
@@ -68,6 +89,12 @@ public:
             return current_;
         }
 
+        /// Access the element at the offset from the iterator: it[n].
+        T& operator[](difference_type n) const
+        {
+            return current_[n];
+        }
+
         /// Check if two iterators are same.
         bool operator==(const Iterator& that) const
         {
@@ -80,6 +107,30 @@ public:
             return !(current_ == that.current_);
         }
 
+        /// Check if this iterator is before that iterator.
+        bool operator<(const Iterator& that) const
+        {
+            return current_ < that.current_;
+        }
+
+        /// Check if this iterator is after that iterator.
+        bool operator>(const Iterator& that) const
+        {
+            return that < *this;
+        }
+
+        /// Check if this iterator is not after that iterator.
+        bool operator<=(const Iterator& that) const
+        {
+            return !(that < *this);
+        }
+
+        /// Check if this iterator is not before that iterator.
+        bool operator>=(const Iterator& that) const
+        {
+            return !(*this < that);
+        }
+
         /// Increment the iterator: ++it.
         Iterator& operator++()
         {
@@ -109,23 +160,160 @@ public:
             --current_;
             return it;
         }
+
+        /// Advance the iterator by n: it += n.
+        Iterator& operator+=(difference_type n)
+        {
+            current_ += n;
+            return *this;
+        }
+
+        /// Move the iterator back by n: it -= n.
+        Iterator& operator-=(difference_type n)
+        {
+            current_ -= n;
+            return *this;
+        }
+
+        /// Return the iterator advanced by n: it + n.
+        Iterator operator+(difference_type n) const
+        {
+            return Iterator(current_ + n);
+        }
+
+        /// Return the iterator advanced by n: n + it.
+        friend Iterator operator+(difference_type n, const Iterator& it)
+        {
+            return it + n;
+        }
+
+        /// Return the iterator moved back by n: it - n.
+        Iterator operator-(difference_type n) const
+        {
+            return Iterator(current_ - n);
+        }
+
+        /// Return the distance from that iterator to this iterator: it1 - it2.
+        difference_type operator-(const Iterator& that) const
+        {
+            return current_ - that.current_;
+        }
     };
 
 protected:
+    // Minimum size for the parallel overloads to actually run in parallel, smaller lists are processed serially.
+    static const size_type PARALLEL_THRESHOLD = 1 << 15;
+
+    // Number of elements checked between two cancellation checks in parallel find.
+    static const size_type FIND_BLOCK = 1 << 10;
+
+    // Minimum size for sort() to use radix sort on integral keys, smaller lists are sorted by std::sort.
+    static const size_type RADIX_THRESHOLD = 1 << 8;
+
     // Available capacity.
-    int capacity_;
+    size_type capacity_;
 
     // Pointer to the data.
     T* data_;
 
-    // Expand capacity safely.
-    void expand_capacity()
+    // Inline buffer provided by a derived class (such as SmallArrayList), not owned by the list. nullptr if there is none.
+    T* inline_;
+
+    // Release the data if it is on the heap.
+    void release()
     {
-        capacity_ = (capacity_ < MAX_CAPACITY / 2) ? capacity_ * 2 : MAX_CAPACITY; // double the capacity until MAX_CAPACITY
-        T* new_data = new T[capacity_];
-        std::copy(data_, data_ + size_, new_data);
-        delete[] data_;
+        if (data_ != inline_)
+        {
+            delete[] data_;
+        }
+    }
+
+    // Move the elements to a new heap buffer of new_capacity. Require new_capacity >= size.
+    void reallocate(size_type new_capacity)
+    {
+        T* new_data = new T[new_capacity];
+        std::move(data_, data_ + size_, new_data);
+        release();
         data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    // Expand capacity safely as the growth policy decides, to at least min_capacity. An unallocated list starts from INIT_CAPACITY.
+    void expand_capacity(size_type min_capacity = 0)
+    {
+        std::size_t grown = Growth::grow_capacity(capacity_, sizeof(T));
+        size_type new_capacity = (capacity_ == 0) ? INIT_CAPACITY : (grown < std::size_t(MAX_CAPACITY)) ? size_type(grown) : MAX_CAPACITY; // grow until MAX_CAPACITY
+        if (new_capacity < min_capacity)
+        {
+            new_capacity = min_capacity;
+        }
+        reallocate(new_capacity);
+    }
+
+    // Shrink capacity after removals as the shrink policy decides, but not below INIT_CAPACITY. The inline buffer is never shrunk.
+    void shrink()
+    {
+        size_type new_capacity = size_type(Shrink::shrink_capacity(size_, capacity_));
+        if (new_capacity < INIT_CAPACITY)
+        {
+            new_capacity = INIT_CAPACITY;
+        }
+        if (new_capacity < capacity_ && data_ != inline_)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Move the elements in [first, last) to d_first, the ranges may overlap. Use memmove for trivially copyable types.
+    static void shift(T* first, T* last, T* d_first)
+    {
+        if (first == last)
+        {
+            return; // nothing to move, and the pointers may be null for an unallocated list
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(d_first, first, (last - first) * sizeof(T));
+        }
+        else if (d_first < first)
+        {
+            std::move(first, last, d_first);
+        }
+        else
+        {
+            std::move_backward(first, last, d_first + (last - first));
+        }
+    }
+
+    // Check whether the range starts inside this list. Inserting such a range would move or free it before it is read.
+    template <typename It>
+    bool overlaps(It first, It last) const
+    {
+        if (first == last)
+        {
+            return false;
+        }
+
+        using Reference = typename std::iterator_traits<It>::reference;
+        if constexpr (std::is_lvalue_reference_v<Reference> && std::is_same_v<std::remove_cv_t<std::remove_reference_t<Reference>>, T>)
+        {
+            const T* element = std::addressof(*first);
+            return !std::less<const T*>()(element, data_) && std::less<const T*>()(element, data_ + size_);
+        }
+        else
+        {
+            return false; // the range does not refer to elements of type T
+        }
+    }
+
+    // Create an empty list that stores the elements in the given inline buffer until it overflows.
+    ArrayList(T* inline_buffer, size_type inline_capacity)
+        : common::Container(0)
+        , capacity_(inline_capacity)
+        , data_(inline_buffer)
+        , inline_(inline_buffer)
+    {
     }
 
 public:
@@ -133,19 +321,21 @@ public:
      * Constructor / Destructor
      */
 
-    /// Create an empty list.
-    ArrayList()
+    /// Create an empty list. No memory is allocated until the first insertion.
+    ArrayList() noexcept
         : common::Container(0)
-        , capacity_(INIT_CAPACITY)
-        , data_(new T[capacity_])
+        , capacity_(0)
+        , data_(nullptr)
+        , inline_(nullptr)
     {
     }
 
     /// Create a list based on the given initializer list.
     ArrayList(const std::initializer_list<T>& il)
-        : common::Container(int(il.size()))
+        : common::Container(size_type(il.size()))
         , capacity_(size_ > INIT_CAPACITY ? size_ : INIT_CAPACITY)
         , data_(new T[capacity_])
+        , inline_(nullptr)
     {
         std::copy(il.begin(), il.end(), data_);
     }
@@ -153,7 +343,7 @@ public:
     /// Destroy the list object.
     ~ArrayList()
     {
-        delete[] data_;
+        release();
     }
 
     /*
@@ -177,14 +367,14 @@ public:
      */
 
     /// Return the reference to the element at the specified position in the list.
-    T& operator[](int index)
+    T& operator[](size_type index)
     {
         common::check_bounds(index, 0, size_);
         return data_[index];
     }
 
     /// Return the const reference to element at the specified position in the list.
-    const T& operator[](int index) const
+    const T& operator[](size_type index) const
     {
         return const_cast<ArrayList&>(*this)[index];
     }
@@ -204,7 +394,7 @@ public:
     /// This element acts as a placeholder, attempting to access it results in undefined behavior.
     Iterator end() const
     {
-        return Iterator(data_ + size_); // not nullptr, because size_ <= capacity_
+        return Iterator(data_ + size_); // equal to begin() if empty, even if data_ is nullptr
     }
 
     /*
@@ -214,7 +404,77 @@ public:
     /// Return an iterator to the first occurrence of the specified element, or end() if the list does not contains the element.
     Iterator find(const T& element) const
     {
-        return std::find(begin(), end(), element);
+        return Iterator(data_ + common::find_index(data_, size_, element));
+    }
+
+    /// Return an iterator to the first occurrence of the specified element, or end() if the list does not contains the element.
+    ///
+    /// Search chunks in parallel on the executor (such as common::ThreadPool). A chunk stops early once an occurrence before it is found.
+    template <typename Executor>
+    Iterator find(Executor& executor, const T& element) const
+    {
+        if (size_ < PARALLEL_THRESHOLD)
+        {
+            return find(element);
+        }
+
+        std::atomic<size_type> found(size_);
+        auto search = [&](size_type begin, size_type end)
+        {
+            for (size_type block = begin; block < end; block += FIND_BLOCK)
+            {
+                if (found.load(std::memory_order_relaxed) < block)
+                {
+                    return; // cancel, an earlier occurrence is found
+                }
+
+                size_type block_end = end - block < FIND_BLOCK ? end : block + FIND_BLOCK;
+                size_type pos = block + common::find_index(data_ + block, block_end - block, element);
+                if (pos != block_end)
+                {
+                    size_type current = found.load();
+                    while (pos < current && !found.compare_exchange_weak(current, pos))
+                    {
+                    }
+                    return;
+                }
+            }
+        };
+        common::parallel_chunks(executor, size_, search);
+
+        return Iterator(data_ + found.load());
+    }
+
+    /// Check whether the list contains the specified element.
+    bool contains(const T& element) const
+    {
+        return common::find_index(data_, size_, element) != size_;
+    }
+
+    /// Return the number of occurrences of the specified element in the list.
+    size_type count(const T& element) const
+    {
+        return common::count_equal(data_, size_, element);
+    }
+
+    /// Return the smallest element of the list.
+    T min() const
+    {
+        common::check_empty(size_);
+        return common::min_value(data_, size_);
+    }
+
+    /// Return the largest element of the list.
+    T max() const
+    {
+        common::check_empty(size_);
+        return common::max_value(data_, size_);
+    }
+
+    /// Return the number of elements that the list can hold without reallocation.
+    size_type capacity() const
+    {
+        return capacity_;
     }
 
     /*
@@ -222,7 +482,7 @@ public:
      */
 
     /// Insert the specified element at the specified position in the list.
-    void insert(int index, const T& element)
+    void insert(size_type index, const T& element)
     {
         // check
         common::check_full(size_, MAX_CAPACITY);
@@ -235,7 +495,7 @@ public:
         }
 
         // shift
-        std::copy_backward(data_ + index, data_ + size_, data_ + size_ + 1);
+        shift(data_ + index, data_ + size_, data_ + index + 1);
 
         // insert
         data_[index] = element; // copy assignment on T
@@ -245,7 +505,7 @@ public:
     }
 
     /// Remove and return the element at the specified position in the list.
-    T remove(int index)
+    T remove(size_type index)
     {
         // check
         common::check_empty(size_);
@@ -255,15 +515,93 @@ public:
         T element = std::move(data_[index]);
 
         // shift
-        std::copy(data_ + index + 1, data_ + size_, data_ + index);
+        shift(data_ + index + 1, data_ + size_, data_ + index);
 
         // resize
         --size_;
+        shrink();
 
         // return element
         return element;
     }
 
+    /// Insert the elements in range [first, last) at the specified position in the list, the tail is shifted only once.
+    ///
+    /// A single-pass range, or a range of this list itself, is first copied into a temporary list.
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    void insert(size_type index, InputIt first, InputIt last)
+    {
+        // check
+        common::check_bounds(index, 0, size_ + 1);
+
+        // a single-pass range can be read only once, and a range of this list would be moved before it is read
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if (!std::is_base_of_v<std::forward_iterator_tag, Category> || overlaps(first, last))
+        {
+            ArrayList buffer;
+            for (; first != last; ++first)
+            {
+                buffer.insert(buffer.size_, *first);
+            }
+            insert(index, buffer.data_, buffer.data_ + buffer.size_);
+            return;
+        }
+
+        size_type count = size_type(std::distance(first, last));
+        if (count > MAX_CAPACITY - size_)
+        {
+            throw std::runtime_error("Error: The container has reached the maximum size.");
+        }
+
+        // expand capacity if need
+        if (size_ + count > capacity_)
+        {
+            expand_capacity(size_ + count);
+        }
+
+        // shift
+        shift(data_ + index, data_ + size_, data_ + index + count);
+
+        // insert
+        std::copy(first, last, data_ + index);
+
+        // resize
+        size_ += count;
+    }
+
+    /// Remove the elements in range [first_index, last_index) from the list, the tail is shifted only once.
+    void erase(size_type first_index, size_type last_index)
+    {
+        // check
+        common::check_bounds(first_index, 0, size_ + 1);
+        common::check_bounds(last_index, first_index, size_ + 1);
+
+        // shift
+        shift(data_ + last_index, data_ + size_, data_ + first_index);
+
+        // resize
+        size_ -= last_index - first_index;
+        shrink();
+    }
+
+    /// Remove all elements satisfying the predicate in one pass, keep the order of the others. Return the number of removed elements.
+    template <typename P>
+    size_type remove_if(const P& predicate)
+    {
+        size_type old_size = size_;
+        size_ = size_type(std::remove_if(data_, data_ + size_, predicate) - data_);
+        shrink();
+        return old_size - size_;
+    }
+
+    /// Retain only the elements satisfying the predicate in one pass, keep their order. Return the number of removed elements.
+    template <typename P>
+    size_type retain(const P& predicate)
+    {
+        return remove_if([&](const T& element)
+                         { return !predicate(element); });
+    }
+
     /// Perform the given action for each element of the list.
     template <typename F>
     ArrayList& map(const F& action)
@@ -273,6 +611,22 @@ public:
         return *this;
     }
 
+    /// Perform the given action for each element of the list, in parallel on the executor (such as common::ThreadPool).
+    template <typename Executor, typename F>
+    ArrayList& map(Executor& executor, const F& action)
+    {
+        if (size_ < PARALLEL_THRESHOLD)
+        {
+            return map(action);
+        }
+
+        auto apply = [&](size_type begin, size_type end)
+        { std::for_each(data_ + begin, data_ + end, action); };
+        common::parallel_chunks(executor, size_, apply);
+
+        return *this;
+    }
+
     /// Reverse the list in place.
     ArrayList& reverse()
     {
@@ -281,12 +635,127 @@ public:
         return *this;
     }
 
+    /// Reverse the list in place, in parallel on the executor (such as common::ThreadPool).
+    template <typename Executor>
+    ArrayList& reverse(Executor& executor)
+    {
+        if (size_ < PARALLEL_THRESHOLD)
+        {
+            return reverse();
+        }
+
+        auto swap = [&](size_type begin, size_type end)
+        { std::swap_ranges(data_ + begin, data_ + end, std::reverse_iterator<T*>(data_ + size_ - begin)); };
+        common::parallel_chunks(executor, size_ / 2, swap);
+
+        return *this;
+    }
+
+    /// Sort the list in place by the comparator (introsort), integral keys in ascending order use radix sort instead.
+    template <typename Compare = std::less<T>>
+    ArrayList& sort(const Compare& cmp = Compare())
+    {
+        if constexpr (common::is_radix_sortable<T, Compare>)
+        {
+            if (size_ >= RADIX_THRESHOLD)
+            {
+                std::unique_ptr<T[]> buffer(new T[size_]);
+                common::radix_sort(data_, buffer.get(), size_);
+
+                return *this;
+            }
+        }
+
+        std::sort(data_, data_ + size_, cmp);
+
+        return *this;
+    }
+
+    /// Sort the list in place by the comparator, with a parallel merge sort on the executor (such as common::ThreadPool).
+    template <typename Executor, typename Compare = std::less<T>, typename = decltype(std::declval<Executor&>().concurrency())>
+    ArrayList& sort(Executor& executor, const Compare& cmp = Compare())
+    {
+        if (size_ < PARALLEL_THRESHOLD)
+        {
+            return sort(cmp);
+        }
+
+        std::unique_ptr<T[]> buffer(new T[size_]); // freed even if a copy or a comparison throws
+        common::parallel_merge_sort(executor, data_, buffer.get(), size_, cmp);
+
+        return *this;
+    }
+
+    /// Merge the sorted list that into this sorted list, keep the order by the comparator, and leave that empty.
+    ///
+    /// The merge is stable: equal elements of this list come before those of that list. It fills from the back, so it needs no buffer.
+    template <typename Compare = std::less<T>>
+    ArrayList& merge(ArrayList& that, const Compare& cmp = Compare())
+    {
+        if (this == &that || that.size_ == 0)
+        {
+            return *this;
+        }
+
+        if (that.size_ > MAX_CAPACITY - size_)
+        {
+            throw std::runtime_error("Error: The container has reached the maximum size.");
+        }
+
+        // expand capacity if need
+        if (size_ + that.size_ > capacity_)
+        {
+            expand_capacity(size_ + that.size_);
+        }
+
+        // merge from the back
+        size_type i = size_ - 1;
+        size_type j = that.size_ - 1;
+        for (size_type k = size_ + that.size_ - 1; j >= 0; k--)
+        {
+            if (i >= 0 && cmp(that.data_[j], data_[i]))
+            {
+                data_[k] = std::move(data_[i--]);
+            }
+            else
+            {
+                data_[k] = std::move(that.data_[j--]);
+            }
+        }
+
+        size_ += that.size_;
+        that.clear();
+
+        return *this;
+    }
+
     /// Remove all of the elements from the list.
     void clear()
     {
         // If the elements themselves are pointers, the pointed-to memory is not touched in any way.
         // Managing the pointer is the user's responsibility.
         size_ = 0;
+        shrink();
+    }
+
+    /// Release the unused capacity. An empty list releases all of its memory.
+    void shrink_to_fit()
+    {
+        if (data_ == inline_)
+        {
+            return; // unallocated, or in the inline buffer of a derived class
+        }
+
+        if (size_ == 0 && inline_ == nullptr)
+        {
+            release();
+            data_ = nullptr;
+            capacity_ = 0;
+        }
+        else if (size_ < capacity_)
+        {
+            reallocate(size_);
+        }
     }
 
     /*
@@ -24,6 +24,7 @@
 #define LINKEDLIST_HPP
 
 #include "../common/Container.hpp"
+#include "../common/sort.hpp"
 #include "../common/utility.hpp"
 
 namespace hellods
@@ -55,9 +56,26 @@ protected:
         }
     };
 
+    // Shared sentinel of unallocated lists, serves as both header and trailer. Its links point to itself and are never written.
+    static Node* empty_node()
+    {
+        static Node empty(T(), &empty, &empty);
+        return &empty;
+    }
+
     // Insert the given element at the given position.
     void insert_node(Node* pos, const T& element)
     {
+        if (pos == empty_node())
+        {
+            // first insertion, allocate the header and trailer
+            header_ = new Node(T());
+            trailer_ = new Node(T(), header_);
+            header_->succ_ = trailer_;
+            p_latest_ = header_;
+            pos = trailer_;
+        }
+
         Node* node = new Node(element, pos->pred_, pos);
         pos->pred_->succ_ = node;
         pos->pred_ = node;
@@ -98,7 +116,7 @@ public:
     public:
         using iterator_category = std::input_iterator_tag;
         using value_type = T;
-        using difference_type = int;
+        using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
 
@@ -158,14 +176,14 @@ public:
     };
 
 protected:
-    // Pointer to the header (rank = -1).
+    // Pointer to the header (rank = -1). Both header and trailer are the shared empty sentinel before the first insertion.
     Node* header_;
 
     // Pointer to the trailer (rank = size).
     Node* trailer_;
 
     // Index of the latest accessed element. For operator[]().
-    int latest_;
+    size_type latest_;
 
     // Pointer to the latest accessed element. For operator[]().
     Node* p_latest_;
@@ -187,21 +205,35 @@ protected:
         p_latest_ = header_;
     }
 
+    // Link the chain of nodes (linked by succ_ and ended by nullptr) between the header and trailer, and restore the pred_ links.
+    void link_chain(Node* head)
+    {
+        Node* pred = header_;
+        for (Node* node = head; node != nullptr; node = node->succ_)
+        {
+            pred->succ_ = node;
+            node->pred_ = pred;
+            pred = node;
+        }
+        pred->succ_ = trailer_;
+        trailer_->pred_ = pred;
+        latest_ = -1;
+        p_latest_ = header_;
+    }
+
 public:
     /*
      * Constructor / Destructor
      */
 
-    /// Create an empty list.
-    LinkedList()
+    /// Create an empty list. No memory is allocated until the first insertion.
+    LinkedList() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_constructible_v<T>)
         : common::Container(0)
-        , header_(new Node(T()))
-        , trailer_(new Node(T()))
+        , header_(empty_node())
+        , trailer_(empty_node())
         , latest_(-1)
         , p_latest_(header_)
     {
-        header_->succ_ = trailer_;
-        trailer_->pred_ = header_;
     }
 
     /// Create a list based on the given initializer list.
@@ -217,9 +249,12 @@ public:
     /// Destroy the list object.
     ~LinkedList()
     {
-        clear_data();
-        delete header_;
-        delete trailer_;
+        if (header_ != empty_node())
+        {
+            clear_data();
+            delete header_;
+            delete trailer_;
+        }
     }
 
     /*
@@ -243,7 +278,7 @@ public:
      */
 
     /// Return the reference to the element at the specified position in the list. list[index] for index in 0..size() will be O(1) on each access.
-    T& operator[](int index)
+    T& operator[](size_type index)
     {
         common::check_bounds(index, 0, size_);
 
@@ -277,7 +312,7 @@ public:
     }
 
     /// Return the const reference to element at the specified position in the list. list[index] for index in 0..size() will be O(1) on each access.
-    const T& operator[](int index) const
+    const T& operator[](size_type index) const
     {
         return const_cast<LinkedList&>(*this)[index];
     }
@@ -315,7 +350,7 @@ public:
      */
 
     /// Insert the specified element at the specified position in the list.
-    void insert(int index, const T& element)
+    void insert(size_type index, const T& element)
     {
         // check
         common::check_full(size_, MAX_CAPACITY);
@@ -326,7 +361,7 @@ public:
         if (index < size_ / 2)
         {
             current = header_->succ_;
-            for (int i = 0; i < index; i++)
+            for (size_type i = 0; i < index; i++)
             {
                 current = current->succ_;
             }
@@ -334,7 +369,7 @@ public:
         else
         {
             current = trailer_; // be careful, index may be same as size
-            for (int i = size_; i > index; i--)
+            for (size_type i = size_; i > index; i--)
             {
                 current = current->pred_;
             }
@@ -345,7 +380,7 @@ public:
     }
 
     /// Remove and return the element at the specified position in the list.
-    T remove(int index)
+    T remove(size_type index)
     {
         // check
         common::check_empty(size_);
@@ -356,7 +391,7 @@ public:
         if (index < size_ / 2)
         {
             current = header_->succ_;
-            for (int i = 0; i < index; i++)
+            for (size_type i = 0; i < index; i++)
             {
                 current = current->succ_;
             }
@@ -364,7 +399,7 @@ public:
         else
         {
             current = trailer_->pred_;
-            for (int i = size_ - 1; i > index; i--)
+            for (size_type i = size_ - 1; i > index; i--)
             {
                 current = current->pred_;
             }
@@ -393,6 +428,11 @@ public:
     /// Reverse the list in place.
     LinkedList& reverse()
     {
+        if (header_ == empty_node())
+        {
+            return *this;
+        }
+
         for (Node* cur = header_; cur != nullptr; cur = cur->pred_)
         {
             std::swap(cur->pred_, cur->succ_);
@@ -402,6 +442,61 @@ public:
         return *this;
     }
 
+    /// Sort the list in place by the comparator with a stable merge sort. Only the links are changed, no node is allocated or copied.
+    template <typename Compare = std::less<T>>
+    LinkedList& sort(const Compare& cmp = Compare())
+    {
+        if (size_ < 2)
+        {
+            return *this;
+        }
+
+        trailer_->pred_->succ_ = nullptr;
+        link_chain(common::sort_nodes(header_->succ_, cmp));
+
+        return *this;
+    }
+
+    /// Merge the sorted list that into this sorted list, keep the order by the comparator, and leave that empty.
+    ///
+    /// The merge is stable: equal elements of this list come before those of that list. The nodes of that list are relinked, not copied.
+    template <typename Compare = std::less<T>>
+    LinkedList& merge(LinkedList& that, const Compare& cmp = Compare())
+    {
+        if (this == &that || that.size_ == 0)
+        {
+            return *this;
+        }
+
+        if (that.size_ > MAX_CAPACITY - size_)
+        {
+            throw std::runtime_error("Error: The container has reached the maximum size.");
+        }
+
+        if (header_ == empty_node())
+        {
+            // unallocated, just take over the nodes of that list
+            std::swap(header_, that.header_);
+            std::swap(trailer_, that.trailer_);
+        }
+        else
+        {
+            trailer_->pred_->succ_ = nullptr;
+            that.trailer_->pred_->succ_ = nullptr;
+            link_chain(common::merge_nodes(header_->succ_, that.header_->succ_, cmp));
+            that.header_->succ_ = that.trailer_;
+            that.trailer_->pred_ = that.header_;
+        }
+
+        size_ += that.size_;
+        that.size_ = 0;
+        latest_ = that.latest_ = -1;
+        p_latest_ = header_;
+        that.p_latest_ = that.header_;
+
+        return *this;
+    }
+
     /// Remove all of the elements from the list.
     void clear()
     {
@@ -24,6 +24,7 @@
 #define SINGLYLINKEDLIST_HPP
 
 #include "../common/Container.hpp"
+#include "../common/sort.hpp"
 #include "../common/utility.hpp"
 
 namespace hellods
@@ -70,7 +71,7 @@ public:
     public:
         using iterator_category = std::input_iterator_tag;
         using value_type = T;
-        using difference_type = int;
+        using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
 
@@ -115,9 +116,16 @@ public:
     };
 
 private:
-    // Pointer to the header (rank = -1).
+    // Pointer to the header (rank = -1). It is the shared empty sentinel before the first insertion.
     Node* header_;
 
+    // Shared sentinel of unallocated lists. It has no successor and is never written.
+    static Node* empty_node()
+    {
+        static Node empty{T()};
+        return &empty;
+    }
+
     // Clear the stored data.
     void clear_data()
     {
@@ -137,16 +145,16 @@ public:
      * Constructor / Destructor
      */
 
-    /// Create an empty list.
-    SinglyLinkedList()
+    /// Create an empty list. No memory is allocated until the first insertion.
+    SinglyLinkedList() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_constructible_v<T>)
         : common::Container(0)
-        , header_(new Node(T()))
+        , header_(empty_node())
     {
     }
 
     /// Create a list based on the given initializer list.
     SinglyLinkedList(const std::initializer_list<T>& il)
-        : common::Container(int(il.size()))
+        : common::Container(size_type(il.size()))
         , header_(new Node(T()))
     {
         Node* current = header_;
@@ -161,8 +169,11 @@ public:
     /// Destroy the list object.
     ~SinglyLinkedList()
     {
-        clear_data();
-        delete header_;
+        if (header_ != empty_node())
+        {
+            clear_data();
+            delete header_;
+        }
     }
 
     /*
@@ -186,12 +197,12 @@ public:
      */
 
     /// Return the reference to the element at the specified position in the list.
-    T& operator[](int index)
+    T& operator[](size_type index)
     {
         common::check_bounds(index, 0, size_);
 
         auto current = header_->succ_;
-        for (int i = 0; i < index; ++i)
+        for (size_type i = 0; i < index; ++i)
         {
             current = current->succ_;
         }
@@ -200,7 +211,7 @@ public:
     }
 
     /// Return the const reference to element at the specified position in the list.
-    const T& operator[](int index) const
+    const T& operator[](size_type index) const
     {
         return const_cast<SinglyLinkedList&>(*this)[index];
     }
@@ -238,15 +249,21 @@ public:
      */
 
     /// Insert the specified element at the specified position in the list.
-    void insert(int index, const T& element)
+    void insert(size_type index, const T& element)
     {
         // check
         common::check_full(size_, MAX_CAPACITY);
         common::check_bounds(index, 0, size_ + 1);
 
+        // allocate the header at the first insertion
+        if (header_ == empty_node())
+        {
+            header_ = new Node(T());
+        }
+
         // index
         auto current = header_;
-        for (int i = 0; i < index; i++)
+        for (size_type i = 0; i < index; i++)
         {
             current = current->succ_;
         }
@@ -260,7 +277,7 @@ public:
     }
 
     /// Remove and return the element at the specified position in the list.
-    T remove(int index)
+    T remove(size_type index)
     {
         // check
         common::check_empty(size_);
@@ -268,7 +285,7 @@ public:
 
         // index
         auto current = header_;
-        for (int i = 0; i < index; i++)
+        for (size_type i = 0; i < index; i++)
         {
             current = current->succ_;
         }
@@ -300,6 +317,11 @@ public:
     /// Reverse the list in place.
     SinglyLinkedList& reverse()
     {
+        if (header_ == empty_node())
+        {
+            return *this;
+        }
+
         auto pre = header_->succ_;
         header_->succ_ = nullptr;
         while (pre)
@@ -313,6 +335,51 @@ public:
         return *this;
     }
 
+    /// Sort the list in place by the comparator with a stable merge sort. Only the links are changed, no node is allocated or copied.
+    template <typename Compare = std::less<T>>
+    SinglyLinkedList& sort(const Compare& cmp = Compare())
+    {
+        if (size_ >= 2)
+        {
+            header_->succ_ = common::sort_nodes(header_->succ_, cmp);
+        }
+
+        return *this;
+    }
+
+    /// Merge the sorted list that into this sorted list, keep the order by the comparator, and leave that empty.
+    ///
+    /// The merge is stable: equal elements of this list come before those of that list. The nodes of that list are relinked, not copied.
+    template <typename Compare = std::less<T>>
+    SinglyLinkedList& merge(SinglyLinkedList& that, const Compare& cmp = Compare())
+    {
+        if (this == &that || that.size_ == 0)
+        {
+            return *this;
+        }
+
+        if (that.size_ > MAX_CAPACITY - size_)
+        {
+            throw std::runtime_error("Error: The container has reached the maximum size.");
+        }
+
+        if (header_ == empty_node())
+        {
+            // unallocated, just take over the nodes of that list
+            std::swap(header_, that.header_);
+        }
+        else
+        {
+            header_->succ_ = common::merge_nodes(header_->succ_, that.header_->succ_, cmp);
+            that.header_->succ_ = nullptr;
+        }
+
+        size_ += that.size_;
+        that.size_ = 0;
+
+        return *this;
+    }
+
     /// Remove all of the elements from the list.
     void clear()
     {
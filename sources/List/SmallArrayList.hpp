@@ -0,0 +1,113 @@
+/**
+ * @file SmallArrayList.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief List implemented by array with inline storage for a few elements.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SMALLARRAYLIST_HPP
+#define SMALLARRAYLIST_HPP
+
+#include "ArrayList.hpp"
+
+namespace hellods
+{
+
+/// List implemented by array, stores up to N elements inline and spills to the heap only when it overflows.
+///
+/// A list that stays small costs no heap allocation, and its elements are stored in the object itself.
+/// It has all operations of ArrayList.
+template <typename T, int N>
+class SmallArrayList : public ArrayList<T>
+{
+    static_assert(N > 0, "The inline capacity must be positive.");
+
+private:
+    // Inline buffer.
+    T buffer_[N];
+
+public:
+    /*
+     * Constructor / Destructor
+     */
+
+    /// Create an empty list.
+    SmallArrayList() noexcept(std::is_nothrow_default_constructible_v<T>)
+        : ArrayList(buffer_, N)
+    {
+    }
+
+    /// Create a list based on the given initializer list.
+    SmallArrayList(const std::initializer_list<T>& il)
+        : ArrayList(buffer_, N)
+    {
+        ArrayList::insert(0, il.begin(), il.end());
+    }
+
+    /// Create a list by copying the elements of the given list.
+    SmallArrayList(const SmallArrayList& that)
+        : ArrayList(buffer_, N)
+    {
+        ArrayList::insert(0, that.begin(), that.end());
+    }
+
+    /// Replace the elements of the list by a copy of the elements of the given list.
+    SmallArrayList& operator=(const SmallArrayList& that)
+    {
+        if (this != &that)
+        {
+            ArrayList::clear();
+            ArrayList::insert(0, that.begin(), that.end());
+        }
+        return *this;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Check whether the elements are currently stored in the inline buffer.
+    bool is_inline() const
+    {
+        return data_ == buffer_;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Release the unused capacity. Move the elements back into the inline buffer if they fit.
+    void shrink_to_fit()
+    {
+        if (!is_inline() && size_ <= N)
+        {
+            std::move(data_, data_ + size_, buffer_);
+            delete[] data_;
+            data_ = buffer_;
+            capacity_ = N;
+        }
+        else
+        {
+            ArrayList::shrink_to_fit();
+        }
+    }
+};
+
+} // namespace hellods
+
+#endif // SMALLARRAYLIST_HPP
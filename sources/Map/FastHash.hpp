@@ -0,0 +1,203 @@
+/**
+ * @file FastHash.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Fast seeded hash function object for hash map.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FASTHASH_HPP
+#define FASTHASH_HPP
+
+#include "../common/utility.hpp"
+
+#include <atomic>      // std::atomic
+#include <cstdint>     // std::uint64_t
+#include <cstring>     // std::memcpy
+#include <random>      // std::random_device
+#include <string_view> // std::string_view
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h> // _umul128
+#endif
+
+namespace hellods
+{
+
+/// Fast seeded hash function object, based on the wyhash algorithm (https://github.com/wangyi-fudan/wyhash).
+///
+/// Hashes strings (anything convertible to std::string_view) and integral types.
+/// It is transparent, so a map keyed by std::string can be looked up by std::string_view or const char* without conversion.
+///
+/// Every default constructed object draws a different seed, so the hash values of a map
+/// can not be predicted from outside, which defends against hash flooding.
+class FastHash
+{
+private:
+    // Secret parameters of wyhash.
+    static constexpr std::uint64_t P0 = 0xa0761d6478bd642full;
+    static constexpr std::uint64_t P1 = 0xe7037ed1a0b428dbull;
+    static constexpr std::uint64_t P2 = 0x8ebc6af09c88c6e3ull;
+    static constexpr std::uint64_t P3 = 0x589965cc75374cc3ull;
+
+    // Seed of this hash function object.
+    std::uint64_t seed_;
+
+    // 64 x 64 -> 128 bit multiply, return the low and high 64 bits in a and b.
+    static void mum(std::uint64_t& a, std::uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+        a = static_cast<std::uint64_t>(r);
+        b = static_cast<std::uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        a = _umul128(a, b, &b);
+#else
+        std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+        std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+        std::uint64_t c = t < rl;
+        std::uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        a = lo;
+        b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+    }
+
+    // Multiply and fold.
+    static std::uint64_t mix(std::uint64_t a, std::uint64_t b)
+    {
+        mum(a, b);
+        return a ^ b;
+    }
+
+    // Read 8 bytes.
+    static std::uint64_t read8(const unsigned char* p)
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        return v;
+    }
+
+    // Read 4 bytes.
+    static std::uint64_t read4(const unsigned char* p)
+    {
+        std::uint32_t v;
+        std::memcpy(&v, p, 4);
+        return v;
+    }
+
+    // Read 1 to 3 bytes.
+    static std::uint64_t read3(const unsigned char* p, std::size_t k)
+    {
+        return (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[k >> 1]) << 8) | p[k - 1];
+    }
+
+    // Generate a different seed for each call.
+    static std::uint64_t random_seed()
+    {
+        static const std::uint64_t base = (std::uint64_t(std::random_device()()) << 32) | std::random_device()();
+        static std::atomic<std::uint64_t> counter(0);
+        return mix(base ^ P0, ++counter ^ P1);
+    }
+
+public:
+    /// Mark as transparent for heterogeneous lookup.
+    using is_transparent = void;
+
+    /// Create a hash function object with a random seed.
+    FastHash()
+        : seed_(random_seed())
+    {
+    }
+
+    /// Create a hash function object with the given seed.
+    explicit FastHash(std::uint64_t seed)
+        : seed_(seed)
+    {
+    }
+
+    /// Hash a string.
+    std::size_t operator()(std::string_view sv) const
+    {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(sv.data());
+        std::size_t len = sv.size();
+        std::uint64_t seed = seed_ ^ mix(seed_ ^ P0, P1);
+        std::uint64_t a, b;
+
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+                b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+            }
+            else if (len > 0)
+            {
+                a = read3(p, len);
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            std::size_t i = len;
+            if (i > 48)
+            {
+                std::uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = mix(read8(p) ^ P1, read8(p + 8) ^ seed);
+                    see1 = mix(read8(p + 16) ^ P2, read8(p + 24) ^ see1);
+                    see2 = mix(read8(p + 32) ^ P3, read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16)
+            {
+                seed = mix(read8(p) ^ P1, read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = read8(p + i - 16);
+            b = read8(p + i - 8);
+        }
+
+        a ^= P1;
+        b ^= seed;
+        mum(a, b);
+        return static_cast<std::size_t>(mix(a ^ P0 ^ len, b ^ P1));
+    }
+
+    /// Hash an integral value.
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    std::size_t operator()(T value) const
+    {
+        std::uint64_t a = static_cast<std::uint64_t>(value) ^ P0;
+        std::uint64_t b = seed_ ^ P1;
+        mum(a, b);
+        return static_cast<std::size_t>(mix(a ^ P0, b ^ P1));
+    }
+};
+
+} // namespace hellods
+
+#endif // FASTHASH_HPP
@@ -26,11 +26,16 @@
 #include "../common/Container.hpp"
 #include "../common/utility.hpp"
 
+#include "FastHash.hpp" // bundled hash function object
+
 namespace hellods
 {
 
 /// Hash map.
-template <typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+///
+/// If `CacheHash` is true, the hash value of each key is stored in its slot, so that rehashing does not call Hash again,
+/// and probing compares the cached hash values before calling Eq. It is worthwhile for keys that are expensive to hash or compare, such as long strings.
+template <typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>, bool CacheHash = false>
 class HashMap : public common::Container
 {
 private:
@@ -43,6 +48,9 @@ private:
         // State of the key-value pair.
         bool full_;
 
+        // Cached hash value of the key if CacheHash, otherwise just a placeholder.
+        std::conditional_t<CacheHash, std::size_t, bool> hash_;
+
         // For convenient.
         const K& key_ = pair_.first;
         V& value_ = pair_.second;
@@ -50,17 +58,20 @@ private:
 
 private:
     // Initial capacity for hash map.
-    static const int INIT_PRIME_CAPACITY = 7;
+    static const size_type INIT_PRIME_CAPACITY = 7;
 
     // Maximum capacity for hash map.
-    static const int MAX_PRIME_CAPACITY = 2147483629; // maximum prime number that < INT_MAX
+    static const size_type MAX_PRIME_CAPACITY = PTRDIFF_MAX > INT_MAX ? size_type(9223372036854775783ll) : size_type(2147483629); // maximum prime number that < PTRDIFF_MAX
 
     // Available capacity.
-    int capacity_;
+    size_type capacity_;
 
     // Pointer to the pairs.
     Pair* data_;
 
+    // Hash function object.
+    Hash hasher_;
+
 public:
     /// Map iterator class.
     ///
@@ -97,7 +108,7 @@ public:
     public:
         using iterator_category = std::input_iterator_tag;
         using value_type = std::pair<const K, V>;
-        using difference_type = int;
+        using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
 
@@ -153,38 +164,116 @@ public:
     };
 
 private:
+    // Enable heterogeneous lookup with Key only if both Hash and Eq are transparent.
+    template <typename Key>
+    using transparent_key = std::enable_if_t<common::is_transparent<Hash>::value && common::is_transparent<Eq>::value, Key>;
+
+    // Check whether the pair holds the key. If CacheHash, reject by the cached hash value first.
+    template <typename Key>
+    bool match(const Pair& pair, const Key& key, std::size_t hash) const
+    {
+        if constexpr (CacheHash)
+        {
+            if (pair.hash_ != hash)
+            {
+                return false;
+            }
+        }
+
+        return Eq()(pair.key_, key);
+    }
+
     // Find the position for key.
-    int find_pos(const K& key) const
+    template <typename Key>
+    size_type find_pos(const Key& key) const
     {
-        int current_pos = Hash()(key) % capacity_;
-        int new_pos = current_pos;
-        int conflict_cnt = 0;
+        return find_pos(key, hasher_(key));
+    }
 
-        while (data_[new_pos].full_ && !Eq()(data_[new_pos].key_, key))
+    // Return the position of the next probe: quadratic probing around the home position with +1, -1, +4, -4, +9, -9, ...
+    size_type probe(size_type home_pos, size_type conflict_cnt) const
+    {
+        size_type new_pos;
+        if (conflict_cnt % 2)
         {
-            if (++conflict_cnt % 2)
+            new_pos = home_pos + (conflict_cnt + 1) * (conflict_cnt + 1) / 4;
+            if (new_pos >= capacity_)
             {
-                new_pos = current_pos + (conflict_cnt + 1) * (conflict_cnt + 1) / 4;
-                if (new_pos >= capacity_)
-                {
-                    new_pos %= capacity_;
-                }
+                new_pos %= capacity_;
             }
-            else
+        }
+        else
+        {
+            new_pos = home_pos - conflict_cnt * conflict_cnt / 4;
+            while (new_pos < 0)
             {
-                new_pos = current_pos - conflict_cnt * conflict_cnt / 4;
-                while (new_pos < 0)
-                {
-                    new_pos += capacity_;
-                }
+                new_pos += capacity_;
             }
         }
+        return new_pos;
+    }
+
+    // Find the position for key with its hash value.
+    template <typename Key>
+    size_type find_pos(const Key& key, std::size_t hash) const
+    {
+        size_type current_pos = hash % capacity_;
+        size_type new_pos = current_pos;
+        size_type conflict_cnt = 0;
+
+        while (data_[new_pos].full_ && !match(data_[new_pos], key, hash))
+        {
+            new_pos = probe(current_pos, ++conflict_cnt);
+        }
 
         return new_pos;
     }
 
+    // Find the position for key, and if the key is absent, insert it with the value constructed from args.
+    // Return the position and whether the key was newly inserted. The key is hashed once and probed once, except when expanded.
+    template <typename... Args>
+    std::pair<size_type, bool> try_insert(const K& key, Args&&... args)
+    {
+        std::size_t hash = hasher_(key);
+        size_type pos = find_pos(key, hash);
+
+        if (data_[pos].full_)
+        {
+            return {pos, false};
+        }
+
+        common::check_full(size_, MAX_PRIME_CAPACITY >> 1);
+
+        // expand capacity first when the loading factor will be too large (> 0.5)
+        if (size_ + 1 > (capacity_ >> 1))
+        {
+            expand_capacity();
+            pos = find_pos(key, hash);
+        }
+
+        data_[pos].full_ = true;
+        if constexpr (CacheHash)
+        {
+            data_[pos].hash_ = hash;
+        }
+        const_cast<K&>(data_[pos].key_) = key;
+        data_[pos].value_ = V(std::forward<Args>(args)...);
+
+        size_++;
+
+        return {pos, true};
+    }
+
+    // Shared table of one empty slot for maps that have not allocated yet.
+    // Lookups on it find nothing without any special case, and it is never written, because the first insertion expands first.
+    static Pair* empty_table()
+    {
+        static Pair empty{};
+        return &empty;
+    }
+
     // Calculate the next prime that > n.
-    static int next_prime(int n)
+    static size_type next_prime(size_type n)
     {
         if (n < INIT_PRIME_CAPACITY)
         {
@@ -206,7 +295,7 @@ private:
         {
             n += 2;
             bool is_prime = true;
-            for (int i = 2; i * i <= n; i++)
+            for (size_type i = 2; i * i <= n; i++)
             {
                 if (n % i == 0)
                 {
@@ -226,33 +315,59 @@ private:
     // Expand capacity and rehash.
     void expand_capacity()
     {
-        int old_capacity = capacity_;
+        size_type old_capacity = capacity_;
         Pair* old_data = data_;
 
         // expand to the next prime greater than twice the current capacity
-        int new_capacity = next_prime(capacity_ * 2);
+        size_type new_capacity = next_prime(capacity_ * 2);
 
         // create new pairs
         Pair* new_data = new Pair[new_capacity];
-        for (int i = 0; i < new_capacity; i++)
+        for (size_type i = 0; i < new_capacity; i++)
         {
             new_data[i].full_ = false;
         }
 
-        // move elements (rehash)
+        // move elements (rehash), reuse the cached hash value if CacheHash
         data_ = new_data;
         capacity_ = new_capacity;
-        size_ = 0;
-        for (int i = 0; i < old_capacity; i++)
+        for (size_type i = 0; i < old_capacity; i++)
         {
             if (old_data[i].full_)
             {
-                insert(old_data[i].key_, old_data[i].value_);
+                // keys are unique, so just find an empty slot without comparing keys
+                std::size_t hash;
+                if constexpr (CacheHash)
+                {
+                    hash = old_data[i].hash_;
+                }
+                else
+                {
+                    hash = hasher_(old_data[i].key_);
+                }
+                size_type home_pos = hash % capacity_;
+                size_type pos = home_pos;
+                size_type conflict_cnt = 0;
+                while (data_[pos].full_)
+                {
+                    pos = probe(home_pos, ++conflict_cnt);
+                }
+
+                data_[pos].full_ = true;
+                if constexpr (CacheHash)
+                {
+                    data_[pos].hash_ = hash;
+                }
+                const_cast<K&>(data_[pos].key_) = std::move(const_cast<K&>(old_data[i].key_));
+                data_[pos].value_ = std::move(old_data[i].value_);
             }
         }
 
         // free old pairs
-        delete[] old_data;
+        if (old_data != empty_table())
+        {
+            delete[] old_data;
+        }
     }
 
 public:
@@ -260,16 +375,19 @@ public:
      * Constructor / Destructor
      */
 
-    /// Create an empty map.
-    HashMap()
+    /// Create an empty map. No memory is allocated until the first insertion.
+    HashMap() noexcept(std::is_nothrow_default_constructible_v<Hash> && std::is_nothrow_copy_constructible_v<Hash> && std::is_nothrow_default_constructible_v<K> && std::is_nothrow_default_constructible_v<V>)
+        : HashMap(Hash())
+    {
+    }
+
+    /// Create an empty map with the given hash function object, for example a seeded one.
+    explicit HashMap(const Hash& hasher)
         : common::Container(0)
-        , capacity_(INIT_PRIME_CAPACITY)
-        , data_(new Pair[capacity_])
+        , capacity_(1)
+        , data_(empty_table())
+        , hasher_(hasher)
     {
-        for (int i = 0; i < capacity_; i++)
-        {
-            data_[i].full_ = false;
-        }
     }
 
     /// Create a map based on the given initializer list.
@@ -285,7 +403,10 @@ public:
     /// Destroy the map object.
     ~HashMap()
     {
-        delete[] data_;
+        if (data_ != empty_table())
+        {
+            delete[] data_;
+        }
     }
 
     /*
@@ -325,7 +446,7 @@ public:
     /// Return the reference of value for key if key is in the map, else throw exception.
     V& operator[](const K& key)
     {
-        int pos = find_pos(key);
+        size_type pos = find_pos(key);
 
         if (!data_[pos].full_)
         {
@@ -341,6 +462,38 @@ public:
         return const_cast<HashMap&>(*this)[key];
     }
 
+    /// Return the value for key if key is in the map, else return the default value.
+    V get_or_default(const K& key, const V& default_value = V()) const
+    {
+        size_type pos = find_pos(key);
+        return data_[pos].full_ ? data_[pos].value_ : default_value;
+    }
+
+    /// Return the reference of value for a key compared equivalent to `key`, else throw exception.
+    ///
+    /// Only participates in overload resolution if both Hash and Eq are transparent.
+    template <typename Key, typename = transparent_key<Key>>
+    V& operator[](const Key& key)
+    {
+        size_type pos = find_pos(key);
+
+        if (!data_[pos].full_)
+        {
+            throw std::runtime_error("Error: The key-value pair does not exist.");
+        }
+
+        return data_[pos].value_;
+    }
+
+    /// Return the const reference of value for a key compared equivalent to `key`, else throw exception.
+    ///
+    /// Only participates in overload resolution if both Hash and Eq are transparent.
+    template <typename Key, typename = transparent_key<Key>>
+    const V& operator[](const Key& key) const
+    {
+        return const_cast<HashMap&>(*this)[key];
+    }
+
     /*
      * Iterator
      */
@@ -364,7 +517,7 @@ public:
     /// Return an iterator to the first occurrence of the specified key, or end() if the map does not contains the key.
     Iterator find(const K& key) const
     {
-        int pos = find_pos(key);
+        size_type pos = find_pos(key);
         return data_[pos].full_ ? Iterator(data_ + pos, data_, data_ + capacity_) : end();
     }
 
@@ -374,6 +527,25 @@ public:
         return data_[find_pos(key)].full_;
     }
 
+    /// Return an iterator to the key compared equivalent to `key`, or end() if the map does not contains such a key.
+    ///
+    /// Only participates in overload resolution if both Hash and Eq are transparent.
+    template <typename Key, typename = transparent_key<Key>>
+    Iterator find(const Key& key) const
+    {
+        size_type pos = find_pos(key);
+        return data_[pos].full_ ? Iterator(data_ + pos, data_, data_ + capacity_) : end();
+    }
+
+    /// Determine whether a key compared equivalent to `key` is in the map.
+    ///
+    /// Only participates in overload resolution if both Hash and Eq are transparent.
+    template <typename Key, typename = transparent_key<Key>>
+    bool contains(const Key& key) const
+    {
+        return data_[find_pos(key)].full_;
+    }
+
     /*
      * Manipulation
      */
@@ -381,33 +553,60 @@ public:
     /// Insert a new key-value pair into the map. Return whether the pair was newly inserted.
     bool insert(const K& key, const V& value)
     {
-        common::check_full(size_, MAX_PRIME_CAPACITY >> 1);
+        return try_insert(key, value).second;
+    }
 
-        int pos = find_pos(key);
+    /// If the key is not in the map, insert it with the value constructed from `args`, otherwise do nothing.
+    /// Return an iterator to the pair of the key and whether the pair was newly inserted.
+    template <typename... Args>
+    std::pair<Iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        auto [pos, inserted] = try_insert(key, std::forward<Args>(args)...);
+        return {Iterator(data_ + pos, data_, data_ + capacity_), inserted};
+    }
 
-        if (data_[pos].full_)
+    /// Insert a new key-value pair into the map, or assign the value if the key is already in the map.
+    /// Return whether the pair was newly inserted.
+    template <typename M>
+    bool insert_or_assign(const K& key, M&& value)
+    {
+        auto [pos, inserted] = try_insert(key, std::forward<M>(value));
+        if (!inserted)
         {
-            return false;
+            data_[pos].value_ = std::forward<M>(value);
         }
+        return inserted;
+    }
 
-        data_[pos].full_ = true;
-        const_cast<K&>(data_[pos].key_) = key;
-        data_[pos].value_ = value;
+    /// Return the reference of value for key, insert the key with the given value first if the key is not in the map.
+    V& find_or_insert(const K& key, const V& value = V())
+    {
+        size_type pos = try_insert(key, value).first; // may expand, so get data_ after it
+        return data_[pos].value_;
+    }
 
-        size_++;
+    /// Remove the key-value pair corresponding to the key in the map. Return whether such a key was present.
+    bool remove(const K& key)
+    {
+        size_type pos = find_pos(key);
 
-        // expand capacity when the loading factor is too large (> 0.5)
-        if (size_ > (capacity_ >> 1))
+        if (!data_[pos].full_)
         {
-            expand_capacity();
+            return false;
         }
+
+        data_[pos].full_ = false;
+        size_--;
         return true;
     }
 
-    /// Remove the key-value pair corresponding to the key in the map. Return whether such a key was present.
-    bool remove(const K& key)
+    /// Remove the key-value pair whose key compared equivalent to `key`. Return whether such a key was present.
+    ///
+    /// Only participates in overload resolution if both Hash and Eq are transparent.
+    template <typename Key, typename = transparent_key<Key>>
+    bool remove(const Key& key)
     {
-        int pos = find_pos(key);
+        size_type pos = find_pos(key);
 
         if (!data_[pos].full_)
         {
@@ -424,7 +623,7 @@ public:
     {
         if (size_ != 0)
         {
-            for (int i = 0; i < capacity_; ++i)
+            for (size_type i = 0; i < capacity_; ++i)
             {
                 data_[i].full_ = false;
             }
@@ -0,0 +1,683 @@
+/**
+ * @file OrderedHashMap.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Hash map that keeps insertion order, with dense entries and a separate index table.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ORDEREDHASHMAP_HPP
+#define ORDEREDHASHMAP_HPP
+
+#include "../common/Container.hpp"
+#include "../common/utility.hpp"
+
+#include <cstdint> // std::uint64_t
+
+namespace hellods
+{
+
+/// Hash map that keeps insertion order.
+///
+/// The key-value pairs are stored densely in an array in insertion order, and the hash table only stores indices into that array.
+/// So iteration is a linear scan over the pairs, without visiting the empty slots of the hash table.
+/// Removed pairs leave holes in the array, which are compacted away once they outnumber the live pairs.
+/// Growing or compacting the array moves every pair, so an insertion or a removal may invalidate all iterators and references.
+template <typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+class OrderedHashMap : public common::Container
+{
+private:
+    // Map entry.
+    struct Entry
+    {
+        // The pair of the key-value.
+        std::pair<const K, V> pair_;
+
+        // Hash value of the key.
+        std::size_t hash_;
+
+        // Whether the entry is alive (not removed).
+        bool alive_;
+    };
+
+    // Maximum capacity of entries, so that the index table (twice the capacity) still fits in size_type.
+    static const size_type MAX_ENTRY_CAPACITY = size_type(1) << (sizeof(size_type) * 8 - 3);
+
+    // Index table value that marks an empty slot.
+    static const size_type EMPTY = -1;
+
+    // Minimum number of entries for the parallel overloads to actually run in parallel, smaller maps are processed serially.
+    static const size_type PARALLEL_THRESHOLD = 1 << 15;
+
+    // Number of used entries, including removed ones.
+    size_type count_;
+
+    // Available capacity of entries, a power of two, or 0 if not allocated yet. The index table has twice the capacity.
+    size_type capacity_;
+
+    // Pointer to the entries.
+    Entry* entries_;
+
+    // Pointer to the index table, open addressing with linear probing.
+    size_type* indices_;
+
+    // Hash function object.
+    Hash hasher_;
+
+public:
+    /// Map iterator class.
+    ///
+    /// Walk the map in insertion order.
+    ///
+    /// Because the internal keys of the map have a fixed position,
+    /// thus the iterator of the map does not support modification for key.
+    class Iterator
+    {
+        friend class OrderedHashMap;
+
+    protected:
+        // Current entry pointer.
+        Entry* current_;
+
+        // Begin of the entries.
+        Entry* buffer_begin_;
+
+        // End of the used entries.
+        Entry* buffer_end_;
+
+        // Constructor.
+        Iterator(Entry* current, Entry* begin, Entry* end)
+            : current_(current)
+            , buffer_begin_(begin)
+            , buffer_end_(end)
+        {
+            while (current_ != buffer_end_ && !current_->alive_)
+            {
+                ++current_;
+            }
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::pair<const K, V>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        bool operator==(const Iterator& that) const
+        {
+            return current_ == that.current_;
+        }
+
+        bool operator!=(const Iterator& that) const
+        {
+            return !(*this == that);
+        }
+
+        std::pair<const K, V>& operator*() const
+        {
+            return current_->pair_;
+        }
+
+        std::pair<const K, V>* operator->() const
+        {
+            return &(operator*());
+        }
+
+        Iterator& operator++()
+        {
+            while (++current_ != buffer_end_ && !current_->alive_)
+            {
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+
+        Iterator& operator--()
+        {
+            while (--current_ != buffer_begin_ && !current_->alive_)
+            {
+            }
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            auto it = *this;
+            --*this;
+            return it;
+        }
+    };
+
+private:
+    // Shared index table of one empty slot for maps that have not allocated yet.
+    // Lookups on it find nothing without any special case, and it is never written, because the first insertion rebuilds first.
+    static size_type* empty_indices()
+    {
+        static size_type empty = EMPTY;
+        return &empty;
+    }
+
+    // Return the home slot of the hash value in the index table (Fibonacci hashing, to spread poor hash values).
+    // The mask is 2 * capacity - 1, or 0 for the single shared slot of an unallocated map.
+    size_type home_slot(std::size_t hash) const
+    {
+        std::uint64_t mixed = std::uint64_t(hash) * 0x9e3779b97f4a7c15ull;
+        return size_type(mixed ^ (mixed >> 32)) & (capacity_ * 2 - (capacity_ != 0)); // fold the well mixed high bits into the low bits
+    }
+
+    // Find the slot in the index table for key. The slot is EMPTY if the map does not contains the key.
+    size_type find_slot(const K& key, std::size_t hash) const
+    {
+        size_type mask = capacity_ * 2 - 1;
+        size_type slot = home_slot(hash);
+
+        while (indices_[slot] != EMPTY)
+        {
+            const Entry& entry = entries_[indices_[slot]];
+            if (entry.alive_ && entry.hash_ == hash && Eq()(entry.pair_.first, key))
+            {
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        return slot;
+    }
+
+    // Move the alive entries in order into a new array of new_capacity, and rebuild the index table.
+    void rebuild(size_type new_capacity)
+    {
+        Entry* new_entries = new Entry[new_capacity];
+        size_type j = 0;
+        for (size_type i = 0; i < count_; i++)
+        {
+            if (entries_[i].alive_)
+            {
+                const_cast<K&>(new_entries[j].pair_.first) = std::move(const_cast<K&>(entries_[i].pair_.first));
+                new_entries[j].pair_.second = std::move(entries_[i].pair_.second);
+                new_entries[j].hash_ = entries_[i].hash_;
+                new_entries[j].alive_ = true;
+                j++;
+            }
+        }
+        delete[] entries_;
+        entries_ = new_entries;
+        count_ = j;
+        capacity_ = new_capacity;
+
+        if (indices_ != empty_indices())
+        {
+            delete[] indices_;
+        }
+        indices_ = new size_type[capacity_ * 2];
+        std::fill(indices_, indices_ + capacity_ * 2, EMPTY);
+
+        index_entries();
+    }
+
+    // Compact the alive entries in order to the front of the entries in place, and reindex them without allocating.
+    // Only the slots of the used entries are cleared, so the cost is proportional to the used entries, not to the capacity.
+    void compact()
+    {
+        // every slot in use points to a used entry, so clearing the slot of each used entry empties the table
+        size_type mask = capacity_ * 2 - 1;
+        for (size_type i = 0; i < count_; i++)
+        {
+            size_type slot = home_slot(entries_[i].hash_);
+            while (indices_[slot] != i)
+            {
+                slot = (slot + 1) & mask;
+            }
+            indices_[slot] = EMPTY;
+        }
+
+        size_type j = 0;
+        for (size_type i = 0; i < count_; i++)
+        {
+            if (entries_[i].alive_)
+            {
+                if (i != j)
+                {
+                    const_cast<K&>(entries_[j].pair_.first) = std::move(const_cast<K&>(entries_[i].pair_.first));
+                    entries_[j].pair_.second = std::move(entries_[i].pair_.second);
+                    entries_[j].hash_ = entries_[i].hash_;
+                    entries_[j].alive_ = true;
+                }
+                j++;
+            }
+        }
+        count_ = j;
+
+        index_entries();
+    }
+
+    // Put the used entries into the index table, which must have no slot in use.
+    void index_entries()
+    {
+        size_type mask = capacity_ * 2 - 1;
+        for (size_type i = 0; i < count_; i++)
+        {
+            size_type slot = home_slot(entries_[i].hash_);
+            while (indices_[slot] != EMPTY)
+            {
+                slot = (slot + 1) & mask;
+            }
+            indices_[slot] = i;
+        }
+    }
+
+    // Free the entries and the index table, unless the index table is the shared one.
+    void release()
+    {
+        delete[] entries_;
+        if (indices_ != empty_indices())
+        {
+            delete[] indices_;
+        }
+    }
+
+    // Forget the entries without freeing them, leaving the map empty and unallocated, after they have been taken over.
+    void reset()
+    {
+        size_ = 0;
+        count_ = 0;
+        capacity_ = 0;
+        entries_ = nullptr;
+        indices_ = empty_indices();
+    }
+
+    // Find the entry for key, and if the key is absent, append it with the value constructed from args.
+    // Return the entry index and whether the key was newly inserted. The key is hashed once and probed once, except when rebuilt.
+    template <typename... Args>
+    std::pair<size_type, bool> try_insert(const K& key, Args&&... args)
+    {
+        std::size_t hash = hasher_(key);
+        size_type slot = find_slot(key, hash);
+
+        if (indices_[slot] != EMPTY)
+        {
+            return {indices_[slot], false};
+        }
+
+        common::check_full(size_, MAX_ENTRY_CAPACITY);
+
+        // no room for a new entry: allocate if unallocated, expand if at least half of the entries are alive, otherwise just compact
+        if (count_ == capacity_)
+        {
+            if (capacity_ != 0 && size_ < (capacity_ >> 1))
+            {
+                compact();
+            }
+            else
+            {
+                rebuild(capacity_ == 0 ? INIT_CAPACITY : capacity_ * 2);
+            }
+            slot = find_slot(key, hash);
+        }
+
+        Entry& entry = entries_[count_];
+        const_cast<K&>(entry.pair_.first) = key;
+        entry.pair_.second = V(std::forward<Args>(args)...);
+        entry.hash_ = hash;
+        entry.alive_ = true;
+        indices_[slot] = count_;
+
+        size_++;
+
+        return {count_++, true};
+    }
+
+public:
+    /*
+     * Constructor / Destructor
+     */
+
+    /// Create an empty map. No memory is allocated until the first insertion.
+    OrderedHashMap() noexcept(std::is_nothrow_default_constructible_v<Hash> && std::is_nothrow_copy_constructible_v<Hash>)
+        : OrderedHashMap(Hash())
+    {
+    }
+
+    /// Create an empty map with the given hash function object, for example a seeded one.
+    explicit OrderedHashMap(const Hash& hasher)
+        : common::Container(0)
+        , count_(0)
+        , capacity_(0)
+        , entries_(nullptr)
+        , indices_(empty_indices())
+        , hasher_(hasher)
+    {
+    }
+
+    /// Create a map based on the given initializer list.
+    OrderedHashMap(const std::initializer_list<std::pair<const K, V>>& il)
+        : OrderedHashMap()
+    {
+        for (auto it = il.begin(); it != il.end(); ++it)
+        {
+            insert(it->first, it->second);
+        }
+    }
+
+    /// Create a map by copying the pairs of the given map, in the same order. The holes of removed pairs are not copied.
+    OrderedHashMap(const OrderedHashMap& that)
+        : OrderedHashMap(that.hasher_)
+    {
+        if (that.size_ == 0)
+        {
+            return;
+        }
+
+        entries_ = new Entry[that.capacity_];
+        capacity_ = that.capacity_;
+        for (size_type i = 0; i < that.count_; i++)
+        {
+            if (that.entries_[i].alive_)
+            {
+                Entry& entry = entries_[count_++];
+                const_cast<K&>(entry.pair_.first) = that.entries_[i].pair_.first;
+                entry.pair_.second = that.entries_[i].pair_.second;
+                entry.hash_ = that.entries_[i].hash_;
+                entry.alive_ = true;
+            }
+        }
+        size_ = count_;
+
+        indices_ = new size_type[capacity_ * 2];
+        std::fill(indices_, indices_ + capacity_ * 2, EMPTY);
+        index_entries();
+    }
+
+    /// Create a map by taking over the entries of the given map, which is left empty.
+    OrderedHashMap(OrderedHashMap&& that) noexcept(std::is_nothrow_copy_constructible_v<Hash>)
+        : common::Container(that.size_)
+        , count_(that.count_)
+        , capacity_(that.capacity_)
+        , entries_(that.entries_)
+        , indices_(that.indices_)
+        , hasher_(that.hasher_)
+    {
+        that.reset();
+    }
+
+    /// Replace the pairs of the map by a copy of the pairs of the given map.
+    OrderedHashMap& operator=(const OrderedHashMap& that)
+    {
+        if (this != &that)
+        {
+            *this = OrderedHashMap(that);
+        }
+        return *this;
+    }
+
+    /// Replace the pairs of the map by taking over the entries of the given map, which is left empty.
+    OrderedHashMap& operator=(OrderedHashMap&& that) noexcept(std::is_nothrow_copy_assignable_v<Hash>)
+    {
+        if (this != &that)
+        {
+            release();
+            size_ = that.size_;
+            count_ = that.count_;
+            capacity_ = that.capacity_;
+            entries_ = that.entries_;
+            indices_ = that.indices_;
+            hasher_ = that.hasher_;
+            that.reset();
+        }
+        return *this;
+    }
+
+    /// Destroy the map object.
+    ~OrderedHashMap()
+    {
+        release();
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Check whether two maps are equal. The insertion order is not taken into account.
+    bool operator==(const OrderedHashMap& that) const
+    {
+        if (size_ != that.size_)
+        {
+            return false;
+        }
+
+        for (const auto& pair : *this)
+        {
+            auto it = that.find(pair.first);
+            if (it == that.end() || pair.second != it->second)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Check whether two maps are not equal.
+    bool operator!=(const OrderedHashMap& that) const
+    {
+        return !(*this == that);
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the reference of value for key if key is in the map, else throw exception.
+    V& operator[](const K& key)
+    {
+        size_type slot = find_slot(key, hasher_(key));
+
+        if (indices_[slot] == EMPTY)
+        {
+            throw std::runtime_error("Error: The key-value pair does not exist.");
+        }
+
+        return entries_[indices_[slot]].pair_.second;
+    }
+
+    /// Return the const reference of value for key if key is in the map, else throw exception.
+    const V& operator[](const K& key) const
+    {
+        return const_cast<OrderedHashMap&>(*this)[key];
+    }
+
+    /// Return the value for key if key is in the map, else return the default value.
+    V get_or_default(const K& key, const V& default_value = V()) const
+    {
+        size_type slot = find_slot(key, hasher_(key));
+        return indices_[slot] != EMPTY ? entries_[indices_[slot]].pair_.second : default_value;
+    }
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first element of the map.
+    Iterator begin() const
+    {
+        return Iterator(entries_, entries_, entries_ + count_);
+    }
+
+    /// Return an iterator to the element following the last element of the map.
+    Iterator end() const
+    {
+        return Iterator(entries_ + count_, entries_, entries_ + count_);
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return an iterator to the first occurrence of the specified key, or end() if the map does not contains the key.
+    Iterator find(const K& key) const
+    {
+        size_type slot = find_slot(key, hasher_(key));
+        return indices_[slot] != EMPTY ? Iterator(entries_ + indices_[slot], entries_, entries_ + count_) : end();
+    }
+
+    /// Determine whether a key is in the map.
+    bool contains(const K& key) const
+    {
+        return indices_[find_slot(key, hasher_(key))] != EMPTY;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Insert a new key-value pair at the end of the map. Return whether the pair was newly inserted.
+    ///
+    /// If the pair is newly inserted, the entries may be reallocated, which invalidates all iterators and references.
+    bool insert(const K& key, const V& value)
+    {
+        return try_insert(key, value).second;
+    }
+
+    /// If the key is not in the map, insert it with the value constructed from `args`, otherwise do nothing.
+    /// Return an iterator to the pair of the key and whether the pair was newly inserted.
+    /// Like insert(), a new pair may invalidate all other iterators and references.
+    template <typename... Args>
+    std::pair<Iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        auto [index, inserted] = try_insert(key, std::forward<Args>(args)...);
+        return {Iterator(entries_ + index, entries_, entries_ + count_), inserted};
+    }
+
+    /// Insert a new key-value pair into the map, or assign the value if the key is already in the map.
+    /// Return whether the pair was newly inserted. Like insert(), a new pair may invalidate all iterators and references.
+    template <typename M>
+    bool insert_or_assign(const K& key, M&& value)
+    {
+        auto [index, inserted] = try_insert(key, std::forward<M>(value));
+        if (!inserted)
+        {
+            entries_[index].pair_.second = std::forward<M>(value);
+        }
+        return inserted;
+    }
+
+    /// Return the reference of value for key, insert the key with the given value first if the key is not in the map.
+    /// Like insert(), a new pair may invalidate all other iterators and references.
+    V& find_or_insert(const K& key, const V& value = V())
+    {
+        size_type index = try_insert(key, value).first; // may rebuild, so get entries_ after it
+        return entries_[index].pair_.second;
+    }
+
+    /// Remove the key-value pair corresponding to the key in the map. Return whether such a key was present.
+    ///
+    /// When the removed pairs come to outnumber the live ones, the entries are compacted in place, without allocating,
+    /// which invalidates all iterators and references, also those to the pairs that were not removed.
+    bool remove(const K& key)
+    {
+        size_type slot = find_slot(key, hasher_(key));
+
+        if (indices_[slot] == EMPTY)
+        {
+            return false;
+        }
+
+        // the slot keeps pointing to the dead entry, acting as a tombstone for probing
+        entries_[indices_[slot]].alive_ = false;
+        size_--;
+
+        // compact when the dead entries outnumber the live ones, so that iteration stays proportional to the size
+        if (count_ - size_ > size_)
+        {
+            compact();
+        }
+        return true;
+    }
+
+    /// Perform the given action for each key-value pair of the map, in insertion order.
+    template <typename F>
+    OrderedHashMap& map(const F& action)
+    {
+        for (size_type i = 0; i < count_; i++)
+        {
+            if (entries_[i].alive_)
+            {
+                action(entries_[i].pair_);
+            }
+        }
+
+        return *this;
+    }
+
+    /// Perform the given action for each key-value pair of the map, in parallel on the executor (such as common::ThreadPool).
+    ///
+    /// The entries are dense, so they are split into chunks of equal length. The action must not insert or remove pairs.
+    template <typename Executor, typename F>
+    OrderedHashMap& map(Executor& executor, const F& action)
+    {
+        if (count_ < PARALLEL_THRESHOLD)
+        {
+            return map(action);
+        }
+
+        auto apply = [&](size_type begin, size_type end)
+        {
+            for (size_type i = begin; i < end; i++)
+            {
+                if (entries_[i].alive_)
+                {
+                    action(entries_[i].pair_);
+                }
+            }
+        };
+        common::parallel_chunks(executor, count_, apply);
+
+        return *this;
+    }
+
+    /// Remove all of the elements from the map.
+    void clear()
+    {
+        if (count_ != 0)
+        {
+            std::fill(indices_, indices_ + capacity_ * 2, EMPTY);
+            count_ = 0;
+            size_ = 0;
+        }
+    }
+
+    /*
+     * Print
+     */
+
+    /// Print the map.
+    friend std::ostream& operator<<(std::ostream& os, const OrderedHashMap& map)
+    {
+        return common::print(os, map, "Map");
+    }
+};
+
+} // namespace hellods
+
+#endif // ORDEREDHASHMAP_HPP
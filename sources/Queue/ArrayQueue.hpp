@@ -29,8 +29,11 @@ namespace hellods
 {
 
 /// Queue implemented by array.
-template <typename T>
-class ArrayQueue : private ArrayDeque<T>
+///
+/// The shrink policy (such as common::QuarterShrink) decides whether removals release memory automatically,
+/// and the growth policy (such as common::HalfGrowth) decides how much the capacity grows when it runs out.
+template <typename T, typename Shrink = common::NoShrink, typename Growth = common::DoubleGrowth>
+class ArrayQueue : private ArrayDeque<T, Shrink, Growth>
 {
 public:
     /*
@@ -38,7 +41,7 @@ public:
      */
 
     /// Create an empty queue.
-    ArrayQueue()
+    ArrayQueue() noexcept
         : ArrayDeque()
     {
     }
@@ -86,7 +89,7 @@ public:
      */
 
     /// Get the number of elements of the queue.
-    int size() const
+    size_type size() const
     {
         return ArrayDeque::size();
     }
@@ -97,6 +100,12 @@ public:
         return ArrayDeque::is_empty();
     }
 
+    /// Return the number of elements that the queue can hold without reallocation.
+    size_type capacity() const
+    {
+        return ArrayDeque::capacity();
+    }
+
     /*
      * Manipulation
      */
@@ -119,6 +128,12 @@ public:
         ArrayDeque::clear();
     }
 
+    /// Release the unused capacity. An empty queue releases all of its memory.
+    void shrink_to_fit()
+    {
+        ArrayDeque::shrink_to_fit();
+    }
+
     /*
      * Print
      */
@@ -38,7 +38,7 @@ public:
      */
 
     /// Create an empty queue.
-    LinkedQueue()
+    LinkedQueue() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_constructible_v<T>)
         : LinkedList()
     {
     }
@@ -87,7 +87,7 @@ public:
      */
 
     /// Get the number of elements of the queue.
-    int size() const
+    size_type size() const
     {
         return LinkedList::size();
     }
@@ -0,0 +1,496 @@
+/**
+ * @file DisjointSet.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Disjoint set (union-find) implemented by parent array.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DISJOINTSET_HPP
+#define DISJOINTSET_HPP
+
+#include "../common/Container.hpp"
+#include "../common/utility.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstdint> // std::int32_t INT32_MAX
+#include <vector>  // std::vector
+
+namespace hellods
+{
+
+/// Disjoint set (union-find) of the elements 0 to n - 1, initially each in its own set.
+///
+/// Each set is a tree whose root is its representative. Find halves the path to the root,
+/// and unite hangs the smaller tree under the larger one, so both take nearly constant amortized time.
+/// The whole structure is one array of 32-bit entries: the parent of an element, or minus the set size at a root.
+class DisjointSet : public common::Container
+{
+private:
+    // Maximum number of elements, so that every element fits in an entry.
+    static const size_type MAX_ELEMENTS = INT32_MAX;
+
+    // Parent of each element, or minus the size of the set if the element is a root.
+    std::int32_t* parent_;
+
+    // Number of disjoint sets.
+    size_type set_count_;
+
+    // Return the root of the tree containing x, pointing every other element on the way to its grandparent.
+    size_type find_root(size_type x)
+    {
+        while (parent_[x] >= 0)
+        {
+            std::int32_t parent = parent_[x];
+            if (parent_[parent] >= 0)
+            {
+                parent_[x] = parent_[parent];
+            }
+            x = parent_[x];
+        }
+        return x;
+    }
+
+    // Unite the sets containing x and y, which are valid. Return false if they are already the same set.
+    bool unite_unchecked(size_type x, size_type y)
+    {
+        x = find_root(x);
+        y = find_root(y);
+        if (x == y)
+        {
+            return false;
+        }
+
+        if (parent_[x] > parent_[y]) // the sizes are negated, so x has the smaller set
+        {
+            std::swap(x, y);
+        }
+        parent_[x] += parent_[y];
+        parent_[y] = std::int32_t(x);
+        set_count_--;
+
+        return true;
+    }
+
+public:
+    /*
+     * Constructor / Destructor
+     */
+
+    /// Create an empty disjoint set.
+    DisjointSet() noexcept
+        : common::Container(0)
+        , parent_(nullptr)
+        , set_count_(0)
+    {
+    }
+
+    /// Create a disjoint set of the elements 0 to n - 1, each in its own set.
+    DisjointSet(size_type n)
+        : common::Container(n)
+        , parent_(nullptr)
+        , set_count_(n)
+    {
+        common::check_full(n - 1, MAX_ELEMENTS); // element n - 1 must fit in an entry
+
+        parent_ = new std::int32_t[n];
+        std::fill(parent_, parent_ + n, -1);
+    }
+
+    /// Create a disjoint set by copying the sets of the given disjoint set.
+    DisjointSet(const DisjointSet& that)
+        : common::Container(that.size_)
+        , parent_(that.size_ == 0 ? nullptr : new std::int32_t[that.size_])
+        , set_count_(that.set_count_)
+    {
+        std::copy(that.parent_, that.parent_ + that.size_, parent_);
+    }
+
+    /// Create a disjoint set by taking over the entries of the given disjoint set, which is left empty.
+    DisjointSet(DisjointSet&& that) noexcept
+        : common::Container(that.size_)
+        , parent_(that.parent_)
+        , set_count_(that.set_count_)
+    {
+        that.size_ = 0;
+        that.parent_ = nullptr;
+        that.set_count_ = 0;
+    }
+
+    /// Replace the sets by a copy of the sets of the given disjoint set.
+    DisjointSet& operator=(const DisjointSet& that)
+    {
+        if (this != &that)
+        {
+            *this = DisjointSet(that);
+        }
+        return *this;
+    }
+
+    /// Replace the sets by taking over the entries of the given disjoint set, which is left empty.
+    DisjointSet& operator=(DisjointSet&& that) noexcept
+    {
+        if (this != &that)
+        {
+            delete[] parent_;
+            size_ = that.size_;
+            parent_ = that.parent_;
+            set_count_ = that.set_count_;
+
+            that.size_ = 0;
+            that.parent_ = nullptr;
+            that.set_count_ = 0;
+        }
+        return *this;
+    }
+
+    /// Destroy the disjoint set object.
+    ~DisjointSet()
+    {
+        delete[] parent_;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of disjoint sets.
+    size_type set_count() const
+    {
+        return set_count_;
+    }
+
+    /// Return the representative element of the set containing x.
+    size_type find(size_type x)
+    {
+        common::check_bounds(x, 0, size_);
+
+        return find_root(x);
+    }
+
+    /// Return the number of elements of the set containing x.
+    size_type set_size(size_type x)
+    {
+        common::check_bounds(x, 0, size_);
+
+        return -parent_[find_root(x)];
+    }
+
+    /// Check whether x and y are in the same set.
+    bool is_connected(size_type x, size_type y)
+    {
+        common::check_bounds(x, 0, size_);
+        common::check_bounds(y, 0, size_);
+
+        return find_root(x) == find_root(y);
+    }
+
+    /// Return the component of each element: the sets numbered from 0 in the order of their first elements.
+    std::vector<size_type> connected_components()
+    {
+        std::vector<size_type> component(size_, -1);
+        size_type count = 0;
+        for (size_type x = 0; x < size_; x++)
+        {
+            size_type root = find_root(x);
+            if (component[root] == -1)
+            {
+                component[root] = count++;
+            }
+            component[x] = component[root];
+        }
+        return component;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Unite the sets containing x and y. Return false if they are already the same set.
+    bool unite(size_type x, size_type y)
+    {
+        common::check_bounds(x, 0, size_);
+        common::check_bounds(y, 0, size_);
+
+        return unite_unchecked(x, y);
+    }
+
+    /// Unite the sets of both ends of each edge (a pair of elements) in [first, last). Return the number of merges.
+    ///
+    /// All edges are checked before any is united, so an invalid edge leaves the set unchanged.
+    template <typename Iterator>
+    size_type unite_all(Iterator first, Iterator last)
+    {
+        for (Iterator it = first; it != last; ++it)
+        {
+            const auto& [x, y] = *it;
+            common::check_bounds(x, 0, size_);
+            common::check_bounds(y, 0, size_);
+        }
+
+        size_type merges = 0;
+        for (; first != last; ++first)
+        {
+            const auto& [x, y] = *first;
+            merges += unite_unchecked(x, y);
+        }
+        return merges;
+    }
+
+    /// Remove all of the elements from the disjoint set.
+    void clear()
+    {
+        if (size_ != 0)
+        {
+            delete[] parent_;
+            parent_ = nullptr;
+            size_ = 0;
+            set_count_ = 0;
+        }
+    }
+};
+
+/// Disjoint set (union-find) whose find and unite can be called from many threads at once, lock-free.
+///
+/// Each element has an atomic 32-bit parent, a root is its own parent. A root is only ever linked under a root
+/// with a smaller index, so every parent only moves to a smaller ancestor, and find can halve the path with
+/// compare-and-swap without ever breaking a tree. Linking by index instead of by size keeps each link
+/// a single atomic step, at the cost of the size heuristic, so the sets do not track their sizes.
+class ConcurrentDisjointSet : public common::Container
+{
+private:
+    // Maximum number of elements, so that every element fits in an entry.
+    static const size_type MAX_ELEMENTS = INT32_MAX;
+
+    // Parent of each element, a root is its own parent.
+    std::atomic<std::int32_t>* parent_;
+
+    // Number of disjoint sets.
+    std::atomic<size_type> set_count_;
+
+    // Return the root of the tree containing x at some moment during the call, halving the path on the way.
+    size_type find_root(size_type x) const
+    {
+        while (true)
+        {
+            std::int32_t parent = parent_[x].load(std::memory_order_acquire);
+            if (parent == x)
+            {
+                return x;
+            }
+            std::int32_t grandparent = parent_[parent].load(std::memory_order_acquire);
+            if (grandparent != parent)
+            {
+                // fails harmlessly if another thread already moved the parent higher
+                parent_[x].compare_exchange_weak(parent, grandparent, std::memory_order_release, std::memory_order_relaxed);
+            }
+            x = grandparent;
+        }
+    }
+
+    // Unite the sets containing x and y, which are valid. Return false if they are already the same set.
+    bool unite_unchecked(size_type x, size_type y)
+    {
+        while (true)
+        {
+            x = find_root(x);
+            y = find_root(y);
+            if (x == y)
+            {
+                return false;
+            }
+
+            if (x < y)
+            {
+                std::swap(x, y);
+            }
+            std::int32_t root = std::int32_t(x);
+            if (parent_[x].compare_exchange_strong(root, std::int32_t(y), std::memory_order_acq_rel))
+            {
+                set_count_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            // x was linked by another thread meanwhile, retry from the new roots
+        }
+    }
+
+public:
+    /*
+     * Constructor / Destructor
+     */
+
+    /// Create an empty disjoint set.
+    ConcurrentDisjointSet() noexcept
+        : common::Container(0)
+        , parent_(nullptr)
+        , set_count_(0)
+    {
+    }
+
+    /// Create a disjoint set of the elements 0 to n - 1, each in its own set.
+    ConcurrentDisjointSet(size_type n)
+        : common::Container(n)
+        , parent_(nullptr)
+        , set_count_(n)
+    {
+        common::check_full(n - 1, MAX_ELEMENTS); // element n - 1 must fit in an entry
+
+        parent_ = new std::atomic<std::int32_t>[n];
+        for (size_type i = 0; i < n; i++)
+        {
+            parent_[i].store(std::int32_t(i), std::memory_order_relaxed);
+        }
+    }
+
+    /// Not copyable: threads share one disjoint set by reference, and a copy taken during unites would be torn.
+    ConcurrentDisjointSet(const ConcurrentDisjointSet&) = delete;
+
+    /// Not copy assignable, for the same reason.
+    ConcurrentDisjointSet& operator=(const ConcurrentDisjointSet&) = delete;
+
+    /// Destroy the disjoint set object.
+    ~ConcurrentDisjointSet()
+    {
+        delete[] parent_;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of disjoint sets.
+    size_type set_count() const
+    {
+        return set_count_.load(std::memory_order_relaxed);
+    }
+
+    /// Return the representative element of the set containing x. Concurrent unites may change it right after.
+    size_type find(size_type x) const
+    {
+        common::check_bounds(x, 0, size_);
+
+        return find_root(x);
+    }
+
+    /// Check whether x and y are in the same set.
+    bool is_connected(size_type x, size_type y) const
+    {
+        common::check_bounds(x, 0, size_);
+        common::check_bounds(y, 0, size_);
+
+        while (true)
+        {
+            x = find_root(x);
+            y = find_root(y);
+            if (x == y)
+            {
+                return true;
+            }
+            if (parent_[x].load(std::memory_order_acquire) == x)
+            {
+                return false; // x is still a root, so the sets were different at that moment
+            }
+        }
+    }
+
+    /// Return the component of each element: the sets numbered from 0 in the order of their first elements.
+    /// Must not run concurrently with unites.
+    std::vector<size_type> connected_components() const
+    {
+        std::vector<size_type> component(size_, -1);
+        size_type count = 0;
+        for (size_type x = 0; x < size_; x++)
+        {
+            size_type root = find_root(x);
+            if (component[root] == -1)
+            {
+                component[root] = count++;
+            }
+            component[x] = component[root];
+        }
+        return component;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Unite the sets containing x and y. Return false if they are already the same set.
+    bool unite(size_type x, size_type y)
+    {
+        common::check_bounds(x, 0, size_);
+        common::check_bounds(y, 0, size_);
+
+        return unite_unchecked(x, y);
+    }
+
+    /// Unite the sets of both ends of each edge (a pair of elements) in [first, last). Return the number of merges.
+    ///
+    /// See the overload with an executor.
+    template <typename Iterator>
+    size_type unite_all(Iterator first, Iterator last)
+    {
+        common::SerialExecutor executor;
+        return unite_all(executor, first, last);
+    }
+
+    /// Unite the sets of both ends of each edge (a pair of elements) in the random access range [first, last),
+    /// in parallel on the executor (such as common::ThreadPool). Return the number of merges.
+    ///
+    /// All edges are checked before any is united, so an invalid edge leaves the set unchanged.
+    template <typename Executor, typename Iterator>
+    size_type unite_all(Executor& executor, Iterator first, Iterator last)
+    {
+        for (Iterator it = first; it != last; ++it)
+        {
+            const auto& [x, y] = *it;
+            common::check_bounds(x, 0, size_);
+            common::check_bounds(y, 0, size_);
+        }
+
+        std::atomic<size_type> merges(0);
+        auto unite_chunk = [&](size_type begin, size_type end)
+        {
+            size_type count = 0;
+            for (size_type i = begin; i < end; i++)
+            {
+                const auto& [x, y] = first[i];
+                count += unite_unchecked(x, y);
+            }
+            merges += count;
+        };
+        common::parallel_chunks(executor, size_type(last - first), unite_chunk);
+
+        return merges.load();
+    }
+
+    /// Remove all of the elements from the disjoint set. Must not run concurrently with other calls.
+    void clear()
+    {
+        if (size_ != 0)
+        {
+            delete[] parent_;
+            parent_ = nullptr;
+            size_ = 0;
+            set_count_ = 0;
+        }
+    }
+};
+
+} // namespace hellods
+
+#endif // DISJOINTSET_HPP
@@ -29,8 +29,11 @@ namespace hellods
 {
 
 /// Stack implemented by array list.
-template <typename T>
-class ArrayStack : private ArrayList<T>
+///
+/// The shrink policy (such as common::QuarterShrink) decides whether removals release memory automatically,
+/// and the growth policy (such as common::HalfGrowth) decides how much the capacity grows when it runs out.
+template <typename T, typename Shrink = common::NoShrink, typename Growth = common::DoubleGrowth>
+class ArrayStack : private ArrayList<T, Shrink, Growth>
 {
 public:
     /*
@@ -38,7 +41,7 @@ public:
      */
 
     /// Create an empty stack.
-    ArrayStack()
+    ArrayStack() noexcept
         : ArrayList()
     {
     }
@@ -87,7 +90,7 @@ public:
      */
 
     /// Get the number of elements of the stack.
-    int size() const
+    size_type size() const
     {
         return ArrayList::size();
     }
@@ -98,6 +101,12 @@ public:
         return ArrayList::is_empty();
     }
 
+    /// Return the number of elements that the stack can hold without reallocation.
+    size_type capacity() const
+    {
+        return ArrayList::capacity();
+    }
+
     /*
      * Manipulation
      */
@@ -120,6 +129,12 @@ public:
         ArrayList::clear();
     }
 
+    /// Release the unused capacity. An empty stack releases all of its memory.
+    void shrink_to_fit()
+    {
+        ArrayList::shrink_to_fit();
+    }
+
     /*
      * Print
      */
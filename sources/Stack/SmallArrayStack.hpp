@@ -0,0 +1,144 @@
+/**
+ * @file SmallArrayStack.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Stack implemented by small array list.
+ * @date 2026.10.18
+ *
+ * @copyright Copyright (C) 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SMALLARRAYSTACK_HPP
+#define SMALLARRAYSTACK_HPP
+
+#include "../List/SmallArrayList.hpp"
+
+namespace hellods
+{
+
+/// Stack implemented by small array list, stores up to N elements inline and spills to the heap only when it overflows.
+template <typename T, int N>
+class SmallArrayStack : private SmallArrayList<T, N>
+{
+public:
+    /*
+     * Constructor / Destructor
+     */
+
+    /// Create an empty stack.
+    SmallArrayStack() noexcept(std::is_nothrow_default_constructible_v<T>)
+        : SmallArrayList()
+    {
+    }
+
+    /// Create a stack based on the given initializer list.
+    SmallArrayStack(const std::initializer_list<T>& il)
+        : SmallArrayList(il)
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Check whether two stacks are equal.
+    bool operator==(const SmallArrayStack& that) const
+    {
+        return static_cast<const SmallArrayList&>(*this) == static_cast<const SmallArrayList&>(that);
+    }
+
+    /// Check whether two stacks are not equal.
+    bool operator!=(const SmallArrayStack& that) const
+    {
+        return !(*this == that);
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the reference to the element at the top in the stack.
+    T& top()
+    {
+        common::check_empty(size());
+        return data_[size() - 1];
+    }
+
+    /// Return the const reference to the element at the top in the stack.
+    const T& top() const
+    {
+        return const_cast<SmallArrayStack&>(*this).top();
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Get the number of elements of the stack.
+    size_type size() const
+    {
+        return SmallArrayList::size();
+    }
+
+    /// Check if the stack is empty.
+    bool is_empty() const
+    {
+        return SmallArrayList::is_empty();
+    }
+
+    /// Check whether the elements are currently stored in the inline buffer.
+    bool is_inline() const
+    {
+        return SmallArrayList::is_inline();
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Push an element at the top of the stack.
+    void push(const T& element)
+    {
+        SmallArrayList::insert(size(), element);
+    }
+
+    /// Pop the top element of the stack.
+    T pop()
+    {
+        return SmallArrayList::remove(size() - 1);
+    }
+
+    /// Remove all of the elements from the stack.
+    void clear()
+    {
+        SmallArrayList::clear();
+    }
+
+    /*
+     * Print
+     */
+
+    /// Print the stack.
+    friend std::ostream& operator<<(std::ostream& os, const SmallArrayStack& stack)
+    {
+        std::ostringstream oss;
+        oss << static_cast<const SmallArrayList&>(stack);
+        return os << "Stack" << oss.str().erase(0, 4);
+    }
+};
+
+} // namespace hellods
+
+#endif // SMALLARRAYSTACK_HPP
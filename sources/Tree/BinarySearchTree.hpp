@@ -32,7 +32,11 @@ namespace hellods
 {
 
 /// Binary search tree.
-template <typename T>
+///
+/// The elements are ordered by Compare, std::less<T> by default, which uses `<`.
+/// If Compare is transparent (declares `is_transparent`, like std::less<>), the lookup functions and remove()
+/// also accept any type comparable with T, so there is no need to construct a temporary T (heterogeneous lookup).
+template <typename T, typename Compare = std::less<T>>
 class BinarySearchTree : public common::Container
 {
 protected:
@@ -160,7 +164,7 @@ public:
     public:
         using iterator_category = std::input_iterator_tag;
         using value_type = T;
-        using difference_type = int;
+        using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
 
@@ -253,10 +257,53 @@ public:
         }
     };
 
+    /// Lazy view of a range of the tree, see range().
+    class Range
+    {
+        friend class BinarySearchTree;
+
+    protected:
+        // Iterator to the first element of the range.
+        Iterator begin_;
+
+        // Iterator to the element following the last element of the range.
+        Iterator end_;
+
+        // Constructor.
+        Range(const Iterator& begin, const Iterator& end)
+            : begin_(begin)
+            , end_(end)
+        {
+        }
+
+    public:
+        /// Return an iterator to the first element of the range.
+        Iterator begin() const
+        {
+            return begin_;
+        }
+
+        /// Return an iterator to the element following the last element of the range.
+        Iterator end() const
+        {
+            return end_;
+        }
+
+        /// Check if the range is empty.
+        bool is_empty() const
+        {
+            return begin_ == end_;
+        }
+    };
+
 protected:
     // Virtual maximum node.
     // In order for the iterator to move back from end, there must be a virtual maximum node.
     // And due to the presence of this node, can simplify the judgment of iterator movement, thereby improving the performance of iterator.
+    // It is stored in the tree object itself, so an empty tree allocates nothing.
+    Node end_node_;
+
+    // Pointer to the virtual maximum node.
     Node* end_;
 
     // Pointer to the root.
@@ -345,11 +392,11 @@ protected:
         }
         else
         {
-            if (element < node->data_)
+            if (Compare()(element, node->data_))
             {
                 node->link_left(insert_node(node->left_, element));
             }
-            else if (node->data_ < element)
+            else if (Compare()(node->data_, element))
             {
                 node->link_right(insert_node(node->right_, element));
             }
@@ -372,20 +419,90 @@ protected:
         return node == nullptr ? end_ : node;
     }
 
+    // Enable heterogeneous lookup with Key only if Compare is transparent.
+    template <typename Key>
+    using transparent_key = std::enable_if_t<common::is_transparent<Compare>::value, Key>;
+
+    // Find the node equivalent to element, or end_ if there is none.
+    template <typename Key>
+    Node* find_node(const Key& element) const
+    {
+        Node* current = root_;
+        while (current)
+        {
+            if (Compare()(current->data_, element))
+            {
+                current = current->right_;
+            }
+            else if (Compare()(element, current->data_))
+            {
+                current = current->left_;
+            }
+            else
+            {
+                return current;
+            }
+        }
+        return end_;
+    }
+
+    // Find the first node not less than element, or end_ if there is none.
+    template <typename Key>
+    Node* lower_bound_node(const Key& element) const
+    {
+        Node* bound = end_;
+        Node* current = root_;
+        while (current)
+        {
+            if (Compare()(current->data_, element))
+            {
+                current = current->right_;
+            }
+            else
+            {
+                bound = current;
+                current = current->left_;
+            }
+        }
+        return bound;
+    }
+
+    // Find the first node greater than element, or end_ if there is none.
+    template <typename Key>
+    Node* upper_bound_node(const Key& element) const
+    {
+        Node* bound = end_;
+        Node* current = root_;
+        while (current)
+        {
+            if (Compare()(element, current->data_))
+            {
+                bound = current;
+                current = current->left_;
+            }
+            else
+            {
+                current = current->right_;
+            }
+        }
+        return bound;
+    }
+
     // Remove node recursively.
-    Node* remove_node(Node* node, const T& element)
+    template <typename Key>
+    Node* remove_node(Node* node, const Key& element)
     {
         if (node)
         {
-            if (element < node->data_)
+            if (Compare()(element, node->data_))
             {
                 node->link_left(remove_node(node->left_, element));
             }
-            else if (node->data_ < element)
+            else if (Compare()(node->data_, element))
             {
                 node->link_right(remove_node(node->right_, element));
             }
-            else // element == node->data_
+            else // element is equivalent to node->data_
             {
                 if (node->left_ && node->right_)
                 {
@@ -407,7 +524,7 @@ protected:
     }
 
     // Return the maximum depth of the subtree rooted at the node.
-    int depth_node(Node* node) const
+    size_type depth_node(Node* node) const
     {
         return node == nullptr ? 0 : 1 + std::max(depth_node(node->left_), depth_node(node->right_));
     }
@@ -417,10 +534,11 @@ public:
      * Constructor / Destructor
      */
 
-    /// Create an empty tree.
-    BinarySearchTree()
+    /// Create an empty tree. No memory is allocated until the first insertion.
+    BinarySearchTree() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_constructible_v<T>)
         : common::Container(0)
-        , end_(new Node(T()))
+        , end_node_(T())
+        , end_(&end_node_)
     {
     }
 
@@ -437,7 +555,7 @@ public:
     /// Destroy the tree object.
     ~BinarySearchTree()
     {
-        destroy(end_);
+        destroy(root_);
     }
 
     /*
@@ -518,33 +636,89 @@ public:
     /// Return an iterator to the specified element, or end() if the tree does not contains the element.
     Iterator find(const T& element) const
     {
-        Node* current = root_;
-        while (current)
-        {
-            if (current->data_ < element)
-            {
-                current = current->right_;
-            }
-            else if (element < current->data_)
-            {
-                current = current->left_;
-            }
-            else
-            {
-                return Iterator(current);
-            }
-        }
-        return end();
+        return Iterator(find_node(element));
+    }
+
+    /// Return an iterator to an element compared equivalent to `element`, or end() if there is no such element.
+    ///
+    /// Only participates in overload resolution if Compare is transparent. The same applies to the other Key overloads below.
+    template <typename Key, typename = transparent_key<Key>>
+    Iterator find(const Key& element) const
+    {
+        return Iterator(find_node(element));
     }
 
     /// Determine whether an element is in the tree.
     bool contains(const T& element) const
     {
-        return find(element) != end();
+        return find_node(element) != end_;
+    }
+
+    /// Determine whether an element compared equivalent to `element` is in the tree.
+    template <typename Key, typename = transparent_key<Key>>
+    bool contains(const Key& element) const
+    {
+        return find_node(element) != end_;
+    }
+
+    /// Return an iterator to the first element not less than the given element, or end() if there is no such element.
+    Iterator lower_bound(const T& element) const
+    {
+        return Iterator(lower_bound_node(element));
+    }
+
+    /// Return an iterator to the first element not less than `element`, or end() if there is no such element.
+    template <typename Key, typename = transparent_key<Key>>
+    Iterator lower_bound(const Key& element) const
+    {
+        return Iterator(lower_bound_node(element));
+    }
+
+    /// Return an iterator to the first element greater than the given element, or end() if there is no such element.
+    Iterator upper_bound(const T& element) const
+    {
+        return Iterator(upper_bound_node(element));
+    }
+
+    /// Return an iterator to the first element greater than `element`, or end() if there is no such element.
+    template <typename Key, typename = transparent_key<Key>>
+    Iterator upper_bound(const Key& element) const
+    {
+        return Iterator(upper_bound_node(element));
+    }
+
+    /// Return a range containing all elements equal to the given element, as a pair of lower_bound() and upper_bound().
+    std::pair<Iterator, Iterator> equal_range(const T& element) const
+    {
+        return {lower_bound(element), upper_bound(element)};
+    }
+
+    /// Return a range containing all elements compared equivalent to `element`, as a pair of lower_bound() and upper_bound().
+    template <typename Key, typename = transparent_key<Key>>
+    std::pair<Iterator, Iterator> equal_range(const Key& element) const
+    {
+        return {lower_bound(element), upper_bound(element)};
+    }
+
+    /// Return a lazy view of the elements in the interval [lo, hi) in ascending order.
+    ///
+    /// Only the two boundaries are located in O(log n), the elements are visited by the iterator on demand.
+    Range range(const T& lo, const T& hi) const
+    {
+        Iterator first = lower_bound(lo);
+        return Compare()(hi, lo) ? Range(first, first) : Range(first, lower_bound(hi));
+    }
+
+    /// Return a lazy view of the elements in the interval [lo, hi) in ascending order.
+    template <typename Key, typename = transparent_key<Key>>
+    Range range(const Key& lo, const Key& hi) const
+    {
+        Iterator first = lower_bound(lo);
+        return Compare()(hi, lo) ? Range(first, first) : Range(first, lower_bound(hi));
     }
 
     /// Return the maximum depth of the tree. Empty tree depth is 0.
-    int depth() const
+    size_type depth() const
     {
         return depth_node(root_);
     }
@@ -556,7 +730,7 @@ public:
     /// Insert the specified element in the tree. Return whether the element was newly inserted.
     bool insert(const T& element)
     {
-        int old_size = size_;
+        size_type old_size = size_;
         end_->link_left(insert_node(root_, element));
         return old_size != size_;
     }
@@ -564,7 +738,16 @@ public:
     /// Remove the specified element from the tree. Return whether such an element was present.
     bool remove(const T& element)
     {
-        int old_size = size_;
+        size_type old_size = size_;
+        end_->link_left(remove_node(root_, element));
+        return old_size != size_;
+    }
+
+    /// Remove the element compared equivalent to `element` from the tree. Return whether such an element was present.
+    template <typename Key, typename = transparent_key<Key>>
+    bool remove(const Key& element)
+    {
+        size_type old_size = size_;
         end_->link_left(remove_node(root_, element));
         return old_size != size_;
     }
@@ -28,9 +28,9 @@
 namespace hellods
 {
 
-/// Red-black tree.
-template <typename T>
-class RedBlackTree : public BinarySearchTree<T>
+/// Red-black tree. The elements are ordered by Compare, see BinarySearchTree.
+template <typename T, typename Compare = std::less<T>>
+class RedBlackTree : public BinarySearchTree<T, Compare>
 {
 private:
     // Rotate right.
@@ -177,14 +177,19 @@ private:
         // find the position for insert
         while (current != nullptr)
         {
-            // if already has the element, do nothing
-            if (element == current->data_)
+            parent = current;
+            if (Compare()(current->data_, element))
             {
-                return;
+                current = current->right_;
+            }
+            else if (Compare()(element, current->data_))
+            {
+                current = current->left_;
+            }
+            else
+            {
+                return; // if already has the element, do nothing
             }
-
-            parent = current;
-            current = current->data_ < element ? current->right_ : current->left_;
         }
 
         // current is nullptr now, here is the position to insert
@@ -200,7 +205,7 @@ private:
         }
 
         // current is not root
-        if (parent->data_ < element)
+        if (Compare()(parent->data_, element))
         {
             parent->link_right(current);
         }
@@ -228,7 +233,7 @@ public:
      */
 
     /// Create an empty tree.
-    RedBlackTree()
+    RedBlackTree() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_constructible_v<T>)
         : BinarySearchTree()
     {
     }
@@ -250,7 +255,7 @@ public:
     /// Insert the specified element in the tree. Return whether the element was newly inserted.
     bool insert(const T& element)
     {
-        int old_size = size_;
+        size_type old_size = size_;
         insert_rbnode(root_, element);
         return old_size != size_;
     }
@@ -258,11 +263,20 @@ public:
     /// Remove the specified element from the tree. Return whether such an element was present.
     bool remove(const T& element)
     {
-        // int old_size = size_;
+        // size_type old_size = size_;
         // remove_rbnode(root_, element);
         // return old_size != size_;
         return BinarySearchTree::remove(element);
     }
+
+    /// Remove the element compared equivalent to `element` from the tree. Return whether such an element was present.
+    ///
+    /// Only participates in overload resolution if Compare is transparent.
+    template <typename Key, typename = std::enable_if_t<common::is_transparent<Compare>::value, Key>>
+    bool remove(const Key& element)
+    {
+        return BinarySearchTree::remove(element);
+    }
 };
 
 } // namespace hellods
@@ -8,31 +8,38 @@
 #ifndef CONTAINER_HPP
 #define CONTAINER_HPP
 
+#include <cstddef> // std::ptrdiff_t
+#include <cstdint> // PTRDIFF_MAX
+
 namespace hellods::common
 {
 
 /// Base container class for HelloDS.
 class Container
 {
+public:
+    /// Signed type of sizes and indices, 64-bit on 64-bit platforms.
+    using size_type = std::ptrdiff_t;
+
 protected:
     // Initial capacity.
-    static const int INIT_CAPACITY = 8;
+    static const size_type INIT_CAPACITY = 8;
 
     // Maximum capacity.
-    static const int MAX_CAPACITY = INT_MAX - 1;
+    static const size_type MAX_CAPACITY = PTRDIFF_MAX - 1;
 
     // Number of elements in the container.
-    int size_;
+    size_type size_;
 
 public:
     /// Constructor.
-    Container(int size)
+    Container(size_type size) noexcept
         : size_(size)
     {
     }
 
     /// Get the number of elements of the container.
-    int size() const
+    size_type size() const
     {
         return size_;
     }
@@ -0,0 +1,109 @@
+/**
+ * @file StampedArray.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Array that resets all of its elements in constant time, for the reusable state of the graph algorithms of HelloDS.
+ * @date 2026.10.18
+ */
+
+#ifndef STAMPEDARRAY_HPP
+#define STAMPEDARRAY_HPP
+
+#include <algorithm> // std::fill
+#include <cstddef>   // std::ptrdiff_t
+#include <cstdint>   // std::uint32_t
+
+namespace hellods::common
+{
+
+/// Array that resets all of its elements in constant time.
+///
+/// Each element carries the epoch of its last write, and reset() starts a new epoch,
+/// so an element not written since then reads as the value given to reset().
+/// The stamps are only cleared when the buffers grow or the 32-bit epoch wraps around.
+template <typename T>
+class StampedArray
+{
+private:
+    // Values, valid where the stamp is the current epoch.
+    T* values_;
+
+    // Epoch of the last write of each element.
+    std::uint32_t* stamps_;
+
+    // Number of allocated elements.
+    std::ptrdiff_t capacity_;
+
+    // Current epoch, 0 is never current.
+    std::uint32_t epoch_;
+
+    // Value of the elements not written in the current epoch.
+    T initial_;
+
+public:
+    /// Create an empty array.
+    StampedArray() noexcept
+        : values_(nullptr)
+        , stamps_(nullptr)
+        , capacity_(0)
+        , epoch_(0)
+        , initial_()
+    {
+    }
+
+    /// The array owns its buffers and is only meant to be reused in place, so it cannot be copied.
+    StampedArray(const StampedArray&) = delete;
+
+    /// The array owns its buffers and is only meant to be reused in place, so it cannot be copied.
+    StampedArray& operator=(const StampedArray&) = delete;
+
+    /// Destroy the array.
+    ~StampedArray()
+    {
+        delete[] values_;
+        delete[] stamps_;
+    }
+
+    /// Reset the elements 0 to n - 1 to value. Constant time unless the array has to grow.
+    void reset(std::ptrdiff_t n, const T& value)
+    {
+        if (n > capacity_)
+        {
+            delete[] values_;
+            delete[] stamps_;
+            values_ = new T[n];
+            stamps_ = new std::uint32_t[n]();
+            capacity_ = n;
+            epoch_ = 0;
+        }
+
+        if (++epoch_ == 0) // wrapped around, the old stamps could look current
+        {
+            std::fill(stamps_, stamps_ + capacity_, 0);
+            epoch_ = 1;
+        }
+        initial_ = value;
+    }
+
+    /// Return the element at index i.
+    const T& get(std::ptrdiff_t i) const
+    {
+        return stamps_[i] == epoch_ ? values_[i] : initial_;
+    }
+
+    /// Set the element at index i.
+    void set(std::ptrdiff_t i, const T& value)
+    {
+        values_[i] = value;
+        stamps_[i] = epoch_;
+    }
+
+    /// Check whether the element at index i is written since the last reset.
+    bool is_set(std::ptrdiff_t i) const
+    {
+        return stamps_[i] == epoch_;
+    }
+};
+
+} // namespace hellods::common
+
+#endif // STAMPEDARRAY_HPP
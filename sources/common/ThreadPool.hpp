@@ -0,0 +1,201 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Small thread pool executor for the parallel algorithms of HelloDS.
+ * @date 2026.10.18
+ */
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <exception>          // std::exception_ptr
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+
+namespace hellods::common
+{
+
+/// Small thread pool executor for the parallel algorithms of HelloDS.
+///
+/// Any type with the same `concurrency()` and `run()` members can be used as an executor instead.
+class ThreadPool
+{
+private:
+    // Number of worker threads, the caller of run() is the extra one.
+    int worker_count_;
+
+    // Worker threads.
+    std::thread* workers_;
+
+    // Serialize the calls to run().
+    std::mutex run_mutex_;
+
+    // Protect the state below.
+    std::mutex mutex_;
+
+    // Notify workers that there is a new job or the pool is stopping.
+    std::condition_variable wake_;
+
+    // Notify the caller that all workers finished the job.
+    std::condition_variable done_;
+
+    // Current job: invoke_(task_, i) runs task i.
+    void (*invoke_)(const void*, int);
+    const void* task_;
+
+    // Number of tasks of the current job.
+    int task_count_;
+
+    // Next task to run.
+    std::atomic<int> next_;
+
+    // Number of workers still working on the current job.
+    int busy_;
+
+    // Generation of the current job, to wake each worker once per job.
+    unsigned generation_;
+
+    // First exception thrown by a task of the current job.
+    std::exception_ptr error_;
+
+    // Whether the pool is stopping.
+    bool stop_;
+
+    // Run tasks of the current job until there is none left.
+    void work()
+    {
+        for (int i = next_++; i < task_count_; i = next_++)
+        {
+            try
+            {
+                invoke_(task_, i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+            }
+        }
+    }
+
+    // Worker thread main loop.
+    void worker_loop()
+    {
+        unsigned seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            wake_.wait(lock, [&]()
+                       { return stop_ || generation_ != seen; });
+            if (stop_)
+            {
+                return;
+            }
+            seen = generation_;
+
+            lock.unlock();
+            work();
+            lock.lock();
+
+            if (--busy_ == 0)
+            {
+                done_.notify_one();
+            }
+        }
+    }
+
+public:
+    /// Create a thread pool with the given concurrency, the default is the number of hardware threads.
+    explicit ThreadPool(int concurrency = int(std::thread::hardware_concurrency()))
+        : worker_count_(concurrency > 1 ? concurrency - 1 : 0)
+        , workers_(new std::thread[worker_count_])
+        , invoke_(nullptr)
+        , task_(nullptr)
+        , task_count_(0)
+        , next_(0)
+        , busy_(0)
+        , generation_(0)
+        , stop_(false)
+    {
+        for (int i = 0; i < worker_count_; i++)
+        {
+            workers_[i] = std::thread(&ThreadPool::worker_loop, this);
+        }
+    }
+
+    /// Stop and join all worker threads.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (int i = 0; i < worker_count_; i++)
+        {
+            workers_[i].join();
+        }
+        delete[] workers_;
+    }
+
+    /// Return the number of threads that run tasks, including the caller of run().
+    int concurrency() const
+    {
+        return worker_count_ + 1;
+    }
+
+    /// Run task(i) for each i in [0, task_count) concurrently, and return after all of them finished.
+    ///
+    /// The calling thread takes part in the work. If any task throws, the first exception is rethrown here.
+    /// A task must not call run() of the same pool.
+    template <typename F>
+    void run(int task_count, const F& task)
+    {
+        if (task_count <= 0)
+        {
+            return;
+        }
+
+        if (worker_count_ == 0 || task_count == 1)
+        {
+            for (int i = 0; i < task_count; i++)
+            {
+                task(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        invoke_ = [](const void* f, int i)
+        { (*static_cast<const F*>(f))(i); };
+        task_ = &task;
+        task_count_ = task_count;
+        next_ = 0;
+        busy_ = worker_count_;
+        error_ = nullptr;
+        ++generation_;
+        lock.unlock();
+        wake_.notify_all();
+
+        work();
+
+        lock.lock();
+        done_.wait(lock, [&]()
+                   { return busy_ == 0; });
+        if (error_)
+        {
+            std::rethrow_exception(error_);
+        }
+    }
+};
+
+} // namespace hellods::common
+
+#endif // THREADPOOL_HPP
@@ -0,0 +1,179 @@
+/**
+ * @file path.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Shortest path kernels for the graphs of HelloDS.
+ * @date 2026.10.18
+ */
+
+#ifndef PATH_HPP
+#define PATH_HPP
+
+#include "search.hpp" // HELLODS_SEARCH_X86 HELLODS_TARGET_AVX2 has_avx2()
+
+#include <algorithm> // std::min
+#include <climits>   // INT_MAX
+#include <cstddef>   // std::ptrdiff_t
+
+namespace hellods::common
+{
+
+// Side of the square tiles of the blocked Floyd-Warshall, a tile of distances and one of vias fit in L1 together.
+static const std::ptrdiff_t FLOYD_TILE = 64;
+
+// Upper bound of dist_k[j] for the relaxation through dist_ik: below it, dist_k[j] is an edge and the sum stays below INT_MAX.
+// A sum that would reach INT_MAX saturates to no edge, so it is never shorter. Require dist_ik != INT_MAX.
+static inline int min_plus_bound(int dist_ik)
+{
+    return INT_MAX - (dist_ik > 0 ? dist_ik : 0);
+}
+
+// Min-plus relaxation of a row through vertex k: for each j, if dist_k[j] < min_plus_bound(dist_ik)
+// and dist_ik + dist_k[j] < dist_i[j], set dist_i[j] to the sum and via_i[j] to via_k[j]. Require dist_ik != INT_MAX.
+static inline void min_plus_row_scalar(int* dist_i, int* via_i, int dist_ik, const int* dist_k, const int* via_k, std::ptrdiff_t n)
+{
+    const int bound = min_plus_bound(dist_ik);
+    for (std::ptrdiff_t j = 0; j < n; j++)
+    {
+        int sum = int(unsigned(dist_ik) + unsigned(dist_k[j])); // computed without overflow, only used when below the bound
+        bool shorter = dist_k[j] < bound && sum < dist_i[j];
+        dist_i[j] = shorter ? sum : dist_i[j];
+        via_i[j] = shorter ? via_k[j] : via_i[j];
+    }
+}
+
+#ifdef HELLODS_SEARCH_X86
+
+// SSE2: min-plus relaxation of a row, see min_plus_row_scalar().
+static inline void min_plus_row_sse2(int* dist_i, int* via_i, int dist_ik, const int* dist_k, const int* via_k, std::ptrdiff_t n)
+{
+    const __m128i ik = _mm_set1_epi32(dist_ik);
+    const __m128i bound = _mm_set1_epi32(min_plus_bound(dist_ik));
+
+    std::ptrdiff_t j = 0;
+    for (; j + 4 <= n; j += 4)
+    {
+        __m128i kj = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dist_k + j));
+        __m128i ij = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dist_i + j));
+        __m128i sum = _mm_add_epi32(ik, kj);
+        __m128i shorter = _mm_and_si128(_mm_cmplt_epi32(kj, bound), _mm_cmplt_epi32(sum, ij));
+        if (_mm_movemask_epi8(shorter) == 0)
+        {
+            continue;
+        }
+        __m128i via = _mm_loadu_si128(reinterpret_cast<const __m128i*>(via_i + j));
+        __m128i via_kj = _mm_loadu_si128(reinterpret_cast<const __m128i*>(via_k + j));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dist_i + j), _mm_or_si128(_mm_and_si128(shorter, sum), _mm_andnot_si128(shorter, ij)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(via_i + j), _mm_or_si128(_mm_and_si128(shorter, via_kj), _mm_andnot_si128(shorter, via)));
+    }
+    min_plus_row_scalar(dist_i + j, via_i + j, dist_ik, dist_k + j, via_k + j, n - j);
+}
+
+// AVX2: min-plus relaxation of a row, see min_plus_row_scalar().
+HELLODS_TARGET_AVX2 static inline void min_plus_row_avx2(int* dist_i, int* via_i, int dist_ik, const int* dist_k, const int* via_k, std::ptrdiff_t n)
+{
+    const __m256i ik = _mm256_set1_epi32(dist_ik);
+    const __m256i bound = _mm256_set1_epi32(min_plus_bound(dist_ik));
+
+    std::ptrdiff_t j = 0;
+    for (; j + 8 <= n; j += 8)
+    {
+        __m256i kj = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dist_k + j));
+        __m256i ij = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dist_i + j));
+        __m256i sum = _mm256_add_epi32(ik, kj);
+        __m256i shorter = _mm256_and_si256(_mm256_cmpgt_epi32(bound, kj), _mm256_cmpgt_epi32(ij, sum));
+        if (_mm256_testz_si256(shorter, shorter))
+        {
+            continue;
+        }
+        __m256i via = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(via_i + j));
+        __m256i via_kj = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(via_k + j));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dist_i + j), _mm256_blendv_epi8(ij, sum, shorter));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(via_i + j), _mm256_blendv_epi8(via, via_kj, shorter));
+    }
+    min_plus_row_scalar(dist_i + j, via_i + j, dist_ik, dist_k + j, via_k + j, n - j);
+}
+
+#endif // HELLODS_SEARCH_X86
+
+// Min-plus relaxation of a row, see min_plus_row_scalar().
+static inline void min_plus_row(int* dist_i, int* via_i, int dist_ik, const int* dist_k, const int* via_k, std::ptrdiff_t n)
+{
+#ifdef HELLODS_SEARCH_X86
+    if (has_avx2())
+    {
+        min_plus_row_avx2(dist_i, via_i, dist_ik, dist_k, via_k, n);
+    }
+    else
+    {
+        min_plus_row_sse2(dist_i, via_i, dist_ik, dist_k, via_k, n);
+    }
+#else
+    min_plus_row_scalar(dist_i, via_i, dist_ik, dist_k, via_k, n);
+#endif
+}
+
+// Floyd-Warshall on the n * n row-major matrices dist (INT_MAX for no edge) and via (the vertex before j on the path from i),
+// blocked into FLOYD_TILE tiles. Each round finishes the diagonal tile, then the tiles in its row and column in parallel,
+// then all other tiles in parallel on the executor.
+template <typename Executor>
+static inline void floyd_warshall(Executor& executor, int* dist, int* via, std::ptrdiff_t n)
+{
+    const std::ptrdiff_t tiles = n / FLOYD_TILE + (n % FLOYD_TILE != 0);
+
+    // relax tile (ti, tj) through the vertices of tile tk, k outermost so that a tile may depend on itself
+    auto relax = [&](std::ptrdiff_t ti, std::ptrdiff_t tj, std::ptrdiff_t tk)
+    {
+        std::ptrdiff_t i_end = std::min(n, (ti + 1) * FLOYD_TILE);
+        std::ptrdiff_t j_begin = tj * FLOYD_TILE;
+        std::ptrdiff_t j_count = std::min(n, j_begin + FLOYD_TILE) - j_begin;
+        std::ptrdiff_t k_end = std::min(n, (tk + 1) * FLOYD_TILE);
+        for (std::ptrdiff_t k = tk * FLOYD_TILE; k < k_end; k++)
+        {
+            const int* dist_k = dist + k * n + j_begin;
+            const int* via_k = via + k * n + j_begin;
+            for (std::ptrdiff_t i = ti * FLOYD_TILE; i < i_end; i++)
+            {
+                int dist_ik = dist[i * n + k];
+                if (dist_ik != INT_MAX)
+                {
+                    min_plus_row(dist + i * n + j_begin, via + i * n + j_begin, dist_ik, dist_k, via_k, j_count);
+                }
+            }
+        }
+    };
+
+    for (std::ptrdiff_t tk = 0; tk < tiles; tk++)
+    {
+        relax(tk, tk, tk);
+
+        // tasks [0, tiles) are the row of the diagonal tile and [tiles, 2 * tiles) its column
+        auto relax_cross = [&](int task)
+        {
+            std::ptrdiff_t t = task % tiles;
+            if (t != tk && task < tiles)
+            {
+                relax(tk, t, tk);
+            }
+            else if (t != tk)
+            {
+                relax(t, tk, tk);
+            }
+        };
+        executor.run(int(2 * tiles), relax_cross);
+
+        auto relax_rest = [&](int task)
+        {
+            std::ptrdiff_t ti = task / tiles;
+            std::ptrdiff_t tj = task % tiles;
+            if (ti != tk && tj != tk)
+            {
+                relax(ti, tj, tk);
+            }
+        };
+        executor.run(int(tiles * tiles), relax_rest);
+    }
+}
+
+} // namespace hellods::common
+
+#endif // PATH_HPP
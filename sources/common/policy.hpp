@@ -0,0 +1,115 @@
+/**
+ * @file policy.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Capacity policies for the array based containers of HelloDS.
+ * @date 2026.10.18
+ */
+
+#ifndef POLICY_HPP
+#define POLICY_HPP
+
+#include <cstddef>
+
+namespace hellods::common
+{
+
+/// Shrink policy that never shrinks automatically. The default, use shrink_to_fit() to release memory explicitly.
+struct NoShrink
+{
+    /// Return the capacity to shrink to for the given size.
+    static std::size_t shrink_capacity(std::size_t /*size*/, std::size_t capacity)
+    {
+        return capacity;
+    }
+};
+
+/// Shrink policy that halves the capacity while less than a quarter of it is used.
+///
+/// After shrinking the container is at least a quarter full and at most half full,
+/// so alternating insertions and removals around a boundary never reallocate repeatedly.
+struct QuarterShrink
+{
+    /// Return the capacity to shrink to for the given size.
+    static std::size_t shrink_capacity(std::size_t size, std::size_t capacity)
+    {
+        while (capacity > 1 && size < capacity / 4)
+        {
+            capacity /= 2;
+        }
+        return capacity;
+    }
+};
+
+/// Growth policy that doubles the capacity. The default, fewest reallocations.
+struct DoubleGrowth
+{
+    /// Return a capacity greater than the given one, the container clamps it to its maximum capacity.
+    static std::size_t grow_capacity(std::size_t capacity, std::size_t /*element_size*/)
+    {
+        return capacity * 2;
+    }
+};
+
+/// Growth policy that grows the capacity by half, less slack at the cost of more reallocations.
+///
+/// Unlike doubling, the sum of the freed blocks eventually exceeds the next request, so the allocator can reuse them.
+struct HalfGrowth
+{
+    /// Return a capacity greater than the given one, the container clamps it to its maximum capacity.
+    static std::size_t grow_capacity(std::size_t capacity, std::size_t /*element_size*/)
+    {
+        return capacity + capacity / 2 + 1;
+    }
+};
+
+/// Growth policy that grows the capacity by a fixed number of elements.
+///
+/// The slack is bounded by Increment, but appending n elements copies O(n^2 / Increment) elements in total.
+template <int Increment>
+struct FixedGrowth
+{
+    static_assert(Increment > 0, "Increment must be positive.");
+
+    /// Return a capacity greater than the given one, the container clamps it to its maximum capacity.
+    static std::size_t grow_capacity(std::size_t capacity, std::size_t /*element_size*/)
+    {
+        return capacity + Increment;
+    }
+};
+
+/// Growth policy that grows the capacity by half and then rounds it up to fill the allocator size class.
+///
+/// Size classes follow jemalloc: multiples of 16 bytes up to 128 bytes, then four classes per power of two.
+/// The elements that fit in the rounding slack are free, since the allocator would hand out the whole class anyway.
+struct SizeClassGrowth
+{
+    /// Round a request of the given bytes up to its allocator size class.
+    static std::size_t size_class(std::size_t bytes)
+    {
+        if (bytes <= 8)
+        {
+            return 8;
+        }
+        if (bytes <= 128)
+        {
+            return (bytes + 15) / 16 * 16;
+        }
+
+        std::size_t spacing = 32; // classes in (2^k, 2^(k+1)] are spaced by 2^(k-2)
+        while (spacing * 8 < bytes)
+        {
+            spacing *= 2;
+        }
+        return (bytes + spacing - 1) / spacing * spacing;
+    }
+
+    /// Return a capacity greater than the given one, the container clamps it to its maximum capacity.
+    static std::size_t grow_capacity(std::size_t capacity, std::size_t element_size)
+    {
+        return size_class((capacity + capacity / 2 + 1) * element_size) / element_size;
+    }
+};
+
+} // namespace hellods::common
+
+#endif // POLICY_HPP
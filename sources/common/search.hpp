@@ -0,0 +1,347 @@
+/**
+ * @file search.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Search kernels over contiguous arrays for HelloDS.
+ * @date 2026.10.18
+ */
+
+#ifndef SEARCH_HPP
+#define SEARCH_HPP
+
+#include <algorithm>   // std::find std::min std::max std::min_element std::max_element
+#include <bitset>      // std::bitset
+#include <cstddef>     // std::ptrdiff_t
+#include <type_traits> // std::is_arithmetic_v std::is_integral_v std::is_same_v
+
+// SIMD kernels are available on x86-64: SSE2 is the baseline there, and AVX2 is selected at runtime if the CPU supports it.
+#if defined(__x86_64__) || defined(_M_X64)
+#define HELLODS_SEARCH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define HELLODS_TARGET_AVX2
+#else
+#define HELLODS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace hellods::common
+{
+
+// Whether the type has SIMD search kernels: integral types and floating point types.
+template <typename T>
+static constexpr bool is_simd_searchable = (std::is_integral_v<T> && sizeof(T) <= 8) || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+#ifdef HELLODS_SEARCH_X86
+
+// Number of mask bits per element. Integral types are compared byte by byte, floating point types lane by lane.
+template <typename T>
+static constexpr int MASK_STRIDE = std::is_integral_v<T> ? int(sizeof(T)) : 1;
+
+// Index of the lowest set bit, require x != 0.
+static inline int lowest_bit(unsigned x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return int(index);
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+// Number of set bits.
+static inline int count_bits(unsigned x)
+{
+    return int(std::bitset<32>(x).count());
+}
+
+// Convert the byte mask of a byte-wise comparison to element mask: the first bit of each element is set if all its bytes are equal.
+template <typename T>
+static inline unsigned element_mask(unsigned byte_mask)
+{
+    unsigned mask = byte_mask;
+    for (int k = 1; k < int(sizeof(T)); k++)
+    {
+        mask &= byte_mask >> k;
+    }
+    constexpr unsigned first_bits = sizeof(T) == 1 ? 0xffffffffu : sizeof(T) == 2 ? 0x55555555u
+                                                               : sizeof(T) == 4   ? 0x11111111u
+                                                                                  : 0x01010101u;
+    return mask & first_bits;
+}
+
+// Check whether the CPU and the OS support AVX2.
+static inline bool has_avx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    static const bool avx2 = []()
+    {
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6) // OSXSAVE, AVX, YMM state enabled
+        {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }();
+#else
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+    return avx2;
+}
+
+// SSE2: broadcast an integral value to all lanes.
+template <typename T>
+static inline __m128i broadcast_sse2(T value)
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm_set1_epi16(static_cast<short>(value));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm_set1_epi32(static_cast<int>(value));
+    }
+    else
+    {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+}
+
+// SSE2: match mask of the 16 bytes at p.
+template <typename T>
+static inline unsigned match_mask_sse2(const T* p, T value)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return unsigned(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p), _mm_set1_ps(value))));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return unsigned(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(p), _mm_set1_pd(value))));
+    }
+    else
+    {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), broadcast_sse2(value));
+        return element_mask<T>(unsigned(_mm_movemask_epi8(eq)));
+    }
+}
+
+// AVX2: broadcast an integral value to all lanes.
+template <typename T>
+HELLODS_TARGET_AVX2 static inline __m256i broadcast_avx2(T value)
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm256_set1_epi16(static_cast<short>(value));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }
+    else
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+}
+
+// AVX2: match mask of the 32 bytes at p.
+template <typename T>
+HELLODS_TARGET_AVX2 static inline unsigned match_mask_avx2(const T* p, T value)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return unsigned(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p), _mm256_set1_ps(value), _CMP_EQ_OQ)));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(p), _mm256_set1_pd(value), _CMP_EQ_OQ)));
+    }
+    else
+    {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), broadcast_avx2(value));
+        return element_mask<T>(unsigned(_mm256_movemask_epi8(eq)));
+    }
+}
+
+// SSE2 kernel of find_index().
+template <typename T>
+static inline std::ptrdiff_t find_index_sse2(const T* data, std::ptrdiff_t n, T value)
+{
+    constexpr int LANES = int(16 / sizeof(T));
+    std::ptrdiff_t i = 0;
+    for (; i + LANES <= n; i += LANES)
+    {
+        unsigned mask = match_mask_sse2(data + i, value);
+        if (mask != 0)
+        {
+            return i + lowest_bit(mask) / MASK_STRIDE<T>;
+        }
+    }
+    for (; i < n; i++)
+    {
+        if (data[i] == value)
+        {
+            return i;
+        }
+    }
+    return n;
+}
+
+// AVX2 kernel of find_index(), checks two vectors per iteration.
+template <typename T>
+HELLODS_TARGET_AVX2 static inline std::ptrdiff_t find_index_avx2(const T* data, std::ptrdiff_t n, T value)
+{
+    constexpr int LANES = int(32 / sizeof(T));
+    std::ptrdiff_t i = 0;
+    for (; i + 2 * LANES <= n; i += 2 * LANES)
+    {
+        unsigned mask0 = match_mask_avx2(data + i, value);
+        unsigned mask1 = match_mask_avx2(data + i + LANES, value);
+        if ((mask0 | mask1) != 0)
+        {
+            return mask0 != 0 ? i + lowest_bit(mask0) / MASK_STRIDE<T> : i + LANES + lowest_bit(mask1) / MASK_STRIDE<T>;
+        }
+    }
+    for (; i < n; i++)
+    {
+        if (data[i] == value)
+        {
+            return i;
+        }
+    }
+    return n;
+}
+
+// SSE2 kernel of count_equal().
+template <typename T>
+static inline std::ptrdiff_t count_equal_sse2(const T* data, std::ptrdiff_t n, T value)
+{
+    constexpr int LANES = int(16 / sizeof(T));
+    std::ptrdiff_t count = 0;
+    std::ptrdiff_t i = 0;
+    for (; i + LANES <= n; i += LANES)
+    {
+        count += count_bits(match_mask_sse2(data + i, value));
+    }
+    for (; i < n; i++)
+    {
+        count += data[i] == value;
+    }
+    return count;
+}
+
+// AVX2 kernel of count_equal().
+template <typename T>
+HELLODS_TARGET_AVX2 static inline std::ptrdiff_t count_equal_avx2(const T* data, std::ptrdiff_t n, T value)
+{
+    constexpr int LANES = int(32 / sizeof(T));
+    std::ptrdiff_t count = 0;
+    std::ptrdiff_t i = 0;
+    for (; i + LANES <= n; i += LANES)
+    {
+        count += count_bits(match_mask_avx2(data + i, value));
+    }
+    for (; i < n; i++)
+    {
+        count += data[i] == value;
+    }
+    return count;
+}
+
+#endif // HELLODS_SEARCH_X86
+
+// Return the index of the first element equal to value in data[0, n), or n if there is no such element.
+template <typename T>
+static inline std::ptrdiff_t find_index(const T* data, std::ptrdiff_t n, const T& value)
+{
+#ifdef HELLODS_SEARCH_X86
+    if constexpr (is_simd_searchable<T>)
+    {
+        return has_avx2() ? find_index_avx2(data, n, value) : find_index_sse2(data, n, value);
+    }
+#endif
+    return std::find(data, data + n, value) - data;
+}
+
+// Return the number of elements equal to value in data[0, n).
+template <typename T>
+static inline std::ptrdiff_t count_equal(const T* data, std::ptrdiff_t n, const T& value)
+{
+#ifdef HELLODS_SEARCH_X86
+    if constexpr (is_simd_searchable<T>)
+    {
+        return has_avx2() ? count_equal_avx2(data, n, value) : count_equal_sse2(data, n, value);
+    }
+#endif
+    std::ptrdiff_t count = 0;
+    for (std::ptrdiff_t i = 0; i < n; i++)
+    {
+        if (data[i] == value)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Return the smallest element in data[0, n). Require n > 0.
+// For arithmetic types it is a branch-free reduction. Compilers can vectorize it for integral types, but not for floating point
+// types without fast-math, since reordering the comparisons would change the result for NaN and signed zero.
+template <typename T>
+static inline T min_value(const T* data, std::ptrdiff_t n)
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        T min = data[0];
+        for (std::ptrdiff_t i = 1; i < n; i++)
+        {
+            min = std::min(min, data[i]);
+        }
+        return min;
+    }
+    else
+    {
+        return *std::min_element(data, data + n);
+    }
+}
+
+// Return the largest element in data[0, n). Require n > 0.
+// For arithmetic types it is a branch-free reduction. Compilers can vectorize it for integral types, but not for floating point
+// types without fast-math, since reordering the comparisons would change the result for NaN and signed zero.
+template <typename T>
+static inline T max_value(const T* data, std::ptrdiff_t n)
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        T max = data[0];
+        for (std::ptrdiff_t i = 1; i < n; i++)
+        {
+            max = std::max(max, data[i]);
+        }
+        return max;
+    }
+    else
+    {
+        return *std::max_element(data, data + n);
+    }
+}
+
+} // namespace hellods::common
+
+#endif // SEARCH_HPP
@@ -0,0 +1,166 @@
+/**
+ * @file sort.hpp
+ * @author Qingyu Chen (chen_qingyu@qq.com, https://chen-qingyu.github.io/)
+ * @brief Sort kernels for the lists of HelloDS.
+ * @date 2026.10.18
+ */
+
+#ifndef SORT_HPP
+#define SORT_HPP
+
+#include <algorithm>   // std::sort std::merge std::move
+#include <cstddef>     // std::ptrdiff_t
+#include <functional>  // std::less
+#include <iterator>    // std::make_move_iterator
+#include <type_traits> // std::is_integral_v std::is_same_v std::make_unsigned_t
+#include <utility>     // std::swap
+
+namespace hellods::common
+{
+
+// Whether sorting by the comparator can use radix_sort(): integral keys in ascending order.
+template <typename T, typename Compare>
+static constexpr bool is_radix_sortable = std::is_integral_v<T> && !std::is_same_v<T, bool> && (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>>);
+
+// Stable LSD radix sort of data[0, n) by bytes, buffer[0, n) is the scratch space. Require n > 0.
+// Passes whose byte is the same for all keys are skipped, so small keys take fewer passes.
+template <typename T>
+static inline void radix_sort(T* data, T* buffer, std::ptrdiff_t n)
+{
+    using U = std::make_unsigned_t<T>;
+    constexpr U SIGN = std::is_signed_v<T> ? U(U(1) << (sizeof(T) * 8 - 1)) : U(0); // flip the sign bit so that negative keys come first
+
+    T* src = data;
+    T* dst = buffer;
+    for (std::size_t shift = 0; shift < sizeof(T) * 8; shift += 8)
+    {
+        std::ptrdiff_t count[256] = {};
+        for (std::ptrdiff_t i = 0; i < n; i++)
+        {
+            count[((U(src[i]) ^ SIGN) >> shift) & 0xff]++;
+        }
+        if (count[((U(src[0]) ^ SIGN) >> shift) & 0xff] == n)
+        {
+            continue; // all keys have the same byte
+        }
+
+        std::ptrdiff_t offset = 0;
+        for (std::ptrdiff_t& c : count)
+        {
+            std::ptrdiff_t next = offset + c;
+            c = offset;
+            offset = next;
+        }
+        for (std::ptrdiff_t i = 0; i < n; i++)
+        {
+            dst[count[((U(src[i]) ^ SIGN) >> shift) & 0xff]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+    {
+        std::copy(src, src + n, data);
+    }
+}
+
+// Sort data[0, n) on the executor: sort one chunk per thread with std::sort, then merge the runs pairwise, each round in parallel.
+// buffer[0, n) is the scratch space.
+template <typename Executor, typename T, typename Compare>
+static inline void parallel_merge_sort(Executor& executor, T* data, T* buffer, std::ptrdiff_t n, const Compare& cmp)
+{
+    int chunk_count = executor.concurrency();
+    std::ptrdiff_t width = n / chunk_count + (n % chunk_count != 0);
+    chunk_count = int(n / width + (n % width != 0));
+
+    auto sort_chunk = [&](int chunk)
+    {
+        std::ptrdiff_t begin = chunk * width;
+        std::sort(data + begin, data + std::min(n, begin + width), cmp);
+    };
+    executor.run(chunk_count, sort_chunk);
+
+    T* src = data;
+    T* dst = buffer;
+    for (; width < n; width *= 2)
+    {
+        auto merge_pair = [&](int pair)
+        {
+            std::ptrdiff_t lo = pair * 2 * width;
+            std::ptrdiff_t mid = std::min(n, lo + width);
+            std::ptrdiff_t hi = std::min(n, mid + width);
+            std::merge(std::make_move_iterator(src + lo), std::make_move_iterator(src + mid),
+                       std::make_move_iterator(src + mid), std::make_move_iterator(src + hi), dst + lo, cmp);
+        };
+        executor.run(int(n / (2 * width) + (n % (2 * width) != 0)), merge_pair);
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+    {
+        std::move(src, src + n, data);
+    }
+}
+
+// Stable merge of two sorted chains of nodes linked by succ_ and ended by nullptr. Return the head of the merged chain.
+// On ties the node from the first chain comes first. Only the links are changed, no node is allocated or copied.
+template <typename Node, typename Compare>
+static inline Node* merge_nodes(Node* first, Node* second, const Compare& cmp)
+{
+    Node* head = nullptr;
+    Node** tail = &head;
+    while (first != nullptr && second != nullptr)
+    {
+        if (cmp(second->data_, first->data_))
+        {
+            *tail = second;
+            second = second->succ_;
+        }
+        else
+        {
+            *tail = first;
+            first = first->succ_;
+        }
+        tail = &(*tail)->succ_;
+    }
+    *tail = first != nullptr ? first : second;
+    return head;
+}
+
+// Stable bottom-up merge sort of a chain of nodes linked by succ_ and ended by nullptr. Return the head of the sorted chain.
+// Runs of 2^i nodes are kept in bins[i], so it needs no allocation and no length.
+template <typename Node, typename Compare>
+static inline Node* sort_nodes(Node* head, const Compare& cmp)
+{
+    Node* bins[sizeof(std::ptrdiff_t) * 8] = {};
+    int top = 0; // bins[top, ...) are empty
+    while (head != nullptr)
+    {
+        Node* run = head;
+        head = head->succ_;
+        run->succ_ = nullptr;
+
+        int i = 0;
+        for (; bins[i] != nullptr; i++)
+        {
+            run = merge_nodes(bins[i], run, cmp); // the earlier nodes are in the bin
+            bins[i] = nullptr;
+        }
+        bins[i] = run;
+        top = std::max(top, i + 1);
+    }
+
+    Node* sorted = nullptr;
+    for (int i = 0; i < top; i++)
+    {
+        if (bins[i] != nullptr)
+        {
+            sorted = merge_nodes(bins[i], sorted, cmp); // higher bins hold earlier nodes
+        }
+    }
+    return sorted;
+}
+
+} // namespace hellods::common
+
+#endif // SORT_HPP
@@ -8,20 +8,22 @@
 #ifndef UTILITY_HPP
 #define UTILITY_HPP
 
-#include <algorithm>  // std::copy
-#include <climits>    // INT_MAX
-#include <cmath>      // std::abs
-#include <functional> // std::std::greater std::hash std::equal_to
-#include <iostream>   // std::ostream
-#include <sstream>    // std::ostringstream
-#include <stdexcept>  // std::runtime_error
-#include <utility>    // std::initializer_list std::move
+#include <algorithm>   // std::copy
+#include <climits>     // INT_MAX
+#include <cmath>       // std::abs
+#include <cstddef>     // std::ptrdiff_t
+#include <functional>  // std::std::greater std::hash std::equal_to
+#include <iostream>    // std::ostream
+#include <sstream>     // std::ostringstream
+#include <stdexcept>   // std::runtime_error
+#include <type_traits> // std::enable_if_t std::void_t
+#include <utility>     // std::initializer_list std::move
 
 namespace hellods::common
 {
 
 // Check whether the index is valid (begin <= pos < end).
-static inline void check_bounds(int pos, int begin, int end)
+static inline void check_bounds(std::ptrdiff_t pos, std::ptrdiff_t begin, std::ptrdiff_t end)
 {
     if (pos < begin || pos >= end)
     {
@@ -30,7 +32,7 @@ static inline void check_bounds(int pos, int begin, int end)
 }
 
 // Check whether is not empty.
-static inline void check_empty(int size)
+static inline void check_empty(std::ptrdiff_t size)
 {
     if (size == 0)
     {
@@ -39,7 +41,7 @@ static inline void check_empty(int size)
 }
 
 // Check whether there is any remaining capacity.
-static inline void check_full(int size, int capacity)
+static inline void check_full(std::ptrdiff_t size, std::ptrdiff_t capacity)
 {
     if (size >= capacity)
     {
@@ -47,6 +49,57 @@ static inline void check_full(int size, int capacity)
     }
 }
 
+// Check whether a function object type is transparent, that is, declares the member type `is_transparent`.
+template <typename F, typename = void>
+struct is_transparent : std::false_type
+{
+};
+
+template <typename F>
+struct is_transparent<F, std::void_t<typename F::is_transparent>> : std::true_type
+{
+};
+
+// Split [0, n) into chunks and call action(begin, end) for each chunk on the executor (such as common::ThreadPool).
+template <typename Executor, typename F>
+static inline void parallel_chunks(Executor& executor, std::ptrdiff_t n, const F& action)
+{
+    if (n <= 0)
+    {
+        return;
+    }
+
+    std::ptrdiff_t chunk_count = executor.concurrency() * 4; // more chunks than threads for load balancing
+    std::ptrdiff_t chunk_size = n / chunk_count + (n % chunk_count != 0);
+    chunk_count = n / chunk_size + (n % chunk_size != 0);
+
+    auto task = [&](int chunk)
+    {
+        std::ptrdiff_t begin = chunk * chunk_size;
+        std::ptrdiff_t end = n - begin < chunk_size ? n : begin + chunk_size;
+        action(begin, end);
+    };
+    executor.run(int(chunk_count), task);
+}
+
+// Executor that runs the tasks one by one on the calling thread, so that an algorithm can share one serial and parallel implementation.
+struct SerialExecutor
+{
+    int concurrency() const
+    {
+        return 1;
+    }
+
+    template <typename F>
+    void run(int task_count, const F& task) const
+    {
+        for (int i = 0; i < task_count; i++)
+        {
+            task(i);
+        }
+    }
+};
+
 // Print function template for iterable container.
 template <typename Iterable>
 static inline std::ostream& print(std::ostream& os, const Iterable& iterable, const std::string& name)
@@ -84,6 +84,205 @@ TEST_CASE("ArrayDeque")
     REQUIRE(some.size() == 5);
 }
 
+TEST_CASE("ArrayDeque iterator")
+{
+    using It = ArrayDeque<int>::Iterator;
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>);
+
+    // a full deque is wrapped around the ring buffer
+    ArrayDeque<int> deque;
+    for (int i = 0; i < 4; i++)
+    {
+        deque.push_back(i * 3 % 8);
+        deque.push_front(i * 5 % 8 + 8);
+    }
+    REQUIRE(deque.size() == deque.capacity());
+    REQUIRE(deque == ArrayDeque<int>({15, 10, 13, 8, 0, 3, 6, 1}));
+
+    // arithmetic and comparison
+    It first = deque.begin();
+    It last = deque.end();
+    REQUIRE(first != last);
+    REQUIRE(last - first == 8);
+    REQUIRE(std::distance(first, last) == 8);
+    REQUIRE(first + 8 == last);
+    REQUIRE(8 + first == last);
+    REQUIRE(last - 8 == first);
+    REQUIRE(first[4] == 0);
+    REQUIRE(first[7] == 1);
+    REQUIRE(first < last);
+    REQUIRE(last > first);
+    REQUIRE(first <= first);
+    REQUIRE(last >= last);
+    It it = first;
+    it += 5;
+    REQUIRE(*it == 3);
+    it -= 4;
+    REQUIRE(*it == 10);
+    REQUIRE(*(last - 1) == 1);
+    REQUIRE(It() == It());
+
+    // std algorithms that require random access
+    std::sort(deque.begin(), deque.end());
+    REQUIRE(deque == ArrayDeque<int>({0, 1, 3, 6, 8, 10, 13, 15}));
+    REQUIRE(std::lower_bound(deque.begin(), deque.end(), 9) - deque.begin() == 5);
+    REQUIRE(*std::upper_bound(deque.begin(), deque.end(), 6) == 8);
+    std::reverse(deque.begin(), deque.end());
+    REQUIRE(deque.front() == 15);
+    REQUIRE(deque.back() == 0);
+    REQUIRE(deque.find(6) - deque.begin() == 4);
+    REQUIRE(deque.find(99) == deque.end());
+}
+
+TEST_CASE("ArrayDeque search")
+{
+    for (int n = 0; n <= 70; n++)
+    {
+        // wrap around the ring buffer by pushing half of the elements at the front
+        ArrayDeque<int> deque;
+        for (int i = n / 2; i < n; i++)
+        {
+            deque.push_back(i + 1);
+        }
+        for (int i = n / 2 - 1; i >= 0; i--)
+        {
+            deque.push_front(i + 1);
+        }
+
+        bool all_found = true;
+        for (int i = 0; i < n; i++)
+        {
+            all_found = all_found && *deque.find(i + 1) == i + 1 && deque.contains(i + 1) && deque.count(i + 1) == 1;
+        }
+        REQUIRE(all_found);
+        REQUIRE(deque.find(0) == deque.end());
+        REQUIRE(deque.contains(0) == false);
+        REQUIRE(deque.count(0) == 0);
+
+        if (n > 0)
+        {
+            REQUIRE(deque.min() == 1);
+            REQUIRE(deque.max() == n);
+        }
+    }
+
+    ArrayDeque<double> deque = {2.5, 1.5};
+    deque.push_front(0.5);
+    deque.push_front(3.5);
+    REQUIRE(deque.count(1.5) == 1);
+    REQUIRE(deque.min() == 0.5);
+    REQUIRE(deque.max() == 3.5);
+    REQUIRE(*++deque.find(0.5) == 2.5);
+    REQUIRE_THROWS_MATCHES(ArrayDeque<int>().min(), std::runtime_error, Message("Error: The container is empty."));
+}
+
+TEST_CASE("Deque lazy allocation")
+{
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<ArrayDeque<int>>);
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<LinkedDeque<int>>);
+
+    ArrayDeque<int> deque;
+    REQUIRE(deque.begin() == deque.end());
+    REQUIRE(deque.find(1) == deque.end());
+    REQUIRE(deque.contains(1) == false);
+    REQUIRE(deque.count(1) == 0);
+    deque.clear();
+
+    // the first insertion allocates, at either end
+    deque.push_front(1);
+    REQUIRE(deque == ArrayDeque<int>({1}));
+    ArrayDeque<int> back;
+    back.push_back(1);
+    REQUIRE(back == deque);
+}
+
+TEST_CASE("ArrayDeque shrink")
+{
+    test<ArrayDeque<int, common::QuarterShrink>>();
+
+    // wrapped around the ring buffer, in order after shrinking
+    ArrayDeque<int, common::QuarterShrink> deque;
+    for (int i = 0; i < 64; i++)
+    {
+        deque.push_back(i);
+        deque.push_front(-i - 1);
+    }
+    REQUIRE(deque.capacity() == 128);
+    for (int i = 0; i < 60; i++)
+    {
+        deque.pop_back();
+        deque.pop_front();
+    }
+    REQUIRE(deque.capacity() == 32);
+    REQUIRE(deque == ArrayDeque<int, common::QuarterShrink>({-4, -3, -2, -1, 0, 1, 2, 3}));
+
+    ArrayDeque<int> fixed = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    fixed.pop_front();
+    fixed.push_back(10); // wrap
+    fixed.pop_front();
+    REQUIRE(fixed.capacity() == 9);
+    fixed.shrink_to_fit();
+    REQUIRE(fixed.capacity() == 8);
+    REQUIRE(fixed == ArrayDeque<int>({3, 4, 5, 6, 7, 8, 9, 10}));
+    fixed.clear();
+    fixed.shrink_to_fit();
+    REQUIRE(fixed.capacity() == 0);
+    fixed.push_front(1);
+    REQUIRE(fixed == ArrayDeque<int>({1}));
+}
+
+TEST_CASE("ArrayDeque growth")
+{
+    test<ArrayDeque<int, common::NoShrink, common::HalfGrowth>>();
+    test<ArrayDeque<int, common::NoShrink, common::FixedGrowth<5>>>();
+    test<ArrayDeque<int, common::QuarterShrink, common::SizeClassGrowth>>();
+
+    // grows while wrapped around the ring buffer
+    ArrayDeque<int, common::NoShrink, common::HalfGrowth> deque;
+    for (int i = 0; i < 7; i++)
+    {
+        deque.push_back(i);
+        deque.push_front(-i - 1);
+    }
+    REQUIRE(deque.capacity() == 20);
+    REQUIRE(deque.front() == -7);
+    REQUIRE(deque.back() == 6);
+
+    ArrayDeque<int, common::NoShrink, common::FixedGrowth<3>> fixed = {1, 2, 3, 4, 5, 6, 7, 8};
+    fixed.push_front(0);
+    REQUIRE(fixed.capacity() == 11);
+    REQUIRE(fixed == ArrayDeque<int, common::NoShrink, common::FixedGrowth<3>>({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+}
+
+TEST_CASE("ArrayDeque copy and move")
+{
+    // copies of a wrapped around deque own their buffers
+    ArrayDeque<int> deque = {3, 4, 5};
+    deque.push_front(2);
+    deque.push_front(1);
+    ArrayDeque<int> copy = deque;
+    copy.push_back(6);
+    REQUIRE(deque == ArrayDeque<int>({1, 2, 3, 4, 5}));
+    REQUIRE(copy == ArrayDeque<int>({1, 2, 3, 4, 5, 6}));
+
+    copy = deque;
+    REQUIRE(copy == deque);
+    auto& alias = copy;
+    copy = alias;
+    REQUIRE(copy == deque);
+    copy = ArrayDeque<int>();
+    REQUIRE(copy.capacity() == 0);
+
+    ArrayDeque<int> moved = std::move(deque);
+    REQUIRE(moved == ArrayDeque<int>({1, 2, 3, 4, 5}));
+    REQUIRE(deque.is_empty() == true);
+    deque.push_back(7);
+    REQUIRE(deque.front() == 7);
+    deque = std::move(moved);
+    REQUIRE(deque == ArrayDeque<int>({1, 2, 3, 4, 5}));
+    REQUIRE(moved.capacity() == 0);
+}
+
 TEST_CASE("LinkedDeque")
 {
     test<LinkedDeque<int>>();
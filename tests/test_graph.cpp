@@ -1,6 +1,7 @@
 #include "tool.hpp"
 
 #include "../sources/Graph/MatrixGraph.hpp"
+#include "../sources/common/ThreadPool.hpp"
 
 using namespace hellods;
 
@@ -75,6 +76,8 @@ TEST_CASE("MatrixGraph")
     REQUIRE(some.is_adjacent(6, 0) == false);
     REQUIRE(some.distance(0, 1) == 2);
     REQUIRE(some.distance(0, 6) == MatrixGraph<>::NO_EDGE);
+    REQUIRE(some.out_degree(3) == 4);
+    REQUIRE(some.out_degree(5) == 0);
 
     some.link(0, 6, 99);
     REQUIRE(some.is_adjacent(0, 6) == true);
@@ -92,14 +95,68 @@ TEST_CASE("MatrixGraph")
     REQUIRE(buf.str() == "0 1 3 2 5 4 6 ");
     buf.str("");
 
+    std::ostringstream post;
+    some.depth_first_search(0, action, [&](const auto& v)
+                            { post << v << " "; });
+    REQUIRE(buf.str() == "0 1 3 2 5 4 6 ");
+    REQUIRE(post.str() == "5 2 6 4 3 1 0 ");
+    buf.str("");
+
     some.breadth_first_search(0, action);
     REQUIRE(buf.str() == "0 1 3 4 2 5 6 ");
     buf.str("");
 
+    REQUIRE(some.strongly_connected_components() == std::vector<MatrixGraph<>::V>{0, 0, 0, 0, 1, 3, 2});
+    REQUIRE(some.has_cycle() == true);
+    REQUIRE_THROWS_MATCHES(some.topological_sort(), std::runtime_error, Message("Error: Cannot sort a graph with a cycle."));
+    some.unlink(2, 0);
+    REQUIRE(some.strongly_connected_components() == std::vector<MatrixGraph<>::V>{0, 1, 5, 2, 3, 6, 4});
+    REQUIRE(some.has_cycle() == false);
+    REQUIRE(some.topological_sort() == std::vector<MatrixGraph<>::V>{0, 1, 3, 2, 4, 6, 5});
+    some.link(2, 0, 4);
+
+    auto [level, parent] = some.breadth_first_levels(0);
+    REQUIRE(level == std::vector<MatrixGraph<>::V>{0, 1, 2, 1, 2, 2, 2});
+    REQUIRE(parent == std::vector<MatrixGraph<>::V>{-1, 0, 3, 0, 1, 3, 3});
+    REQUIRE(some.breadth_first_levels(5).first == std::vector<MatrixGraph<>::V>{-1, -1, -1, -1, -1, 0, -1});
+    REQUIRE_THROWS_MATCHES(some.breadth_first_levels(7), std::runtime_error, Message("Error: Index out of range."));
+
     auto [dist, path] = some.dijkstra(0);
     REQUIRE(dist == std::vector<MatrixGraph<>::E>{0, 2, 3, 1, 3, 6, 5});
     REQUIRE(path == std::vector<MatrixGraph<>::V>{-1, 0, 3, 0, 3, 6, 3});
 
+    using Route = std::pair<MatrixGraph<>::E, std::vector<MatrixGraph<>::V>>;
+    auto zero = [](auto)
+    { return 0; };
+    REQUIRE(some.astar(0, 5, zero) == Route{6, {0, 3, 6, 5}});
+    REQUIRE(some.astar(0, 0, zero) == Route{0, {0}});
+    REQUIRE(some.astar(5, 0, zero) == Route{MatrixGraph<>::NO_EDGE, {}});
+    REQUIRE(some.bidirectional_dijkstra(0, 5) == Route{6, {0, 3, 6, 5}});
+    REQUIRE(some.bidirectional_dijkstra(2, 2) == Route{0, {2}});
+    REQUIRE(some.bidirectional_dijkstra(5, 0) == Route{MatrixGraph<>::NO_EDGE, {}});
+    REQUIRE(some.bidirectional_dijkstra(4, 2) == Route{MatrixGraph<>::NO_EDGE, {}});
+    REQUIRE_THROWS_MATCHES(some.astar(0, 7, zero), std::runtime_error, Message("Error: Index out of range."));
+    for (int u = 0; u < 7; u++)
+    {
+        for (int v = 0; v < 7; v++)
+        {
+            REQUIRE(some.astar(u, v, zero).first == some.dijkstra(u).first[v]);
+            REQUIRE(some.bidirectional_dijkstra(u, v).first == some.dijkstra(u).first[v]);
+        }
+    }
+
+    auto [all_dist, all_path] = some.all_pairs_shortest_paths();
+    REQUIRE(all_dist[0] == dist);
+    REQUIRE(all_path[0] == path);
+    for (int v = 1; v < 7; v++)
+    {
+        REQUIRE(all_dist[v] == some.dijkstra(v).first);
+        REQUIRE(some.bellman_ford(v).first == all_dist[v]);
+    }
+    REQUIRE(some.bellman_ford(0) == std::pair{dist, path});
+    REQUIRE(some.johnson() == std::pair{all_dist, all_path});
+    REQUIRE_THROWS_MATCHES(some.bellman_ford(7), std::runtime_error, Message("Error: Index out of range."));
+
     // Print
     std::ostringstream oss;
 
@@ -126,3 +183,572 @@ Graph(\n\
     some.clear(); // double clear
     REQUIRE(some == empty);
 }
+
+TEST_CASE("MatrixGraph unweighted")
+{
+    using Graph = MatrixGraph<true, false>;
+
+    Graph empty;
+    Graph some(7);
+    REQUIRE(empty == Graph());
+    REQUIRE(some == Graph(7));
+    REQUIRE(some != Graph(6));
+
+    // the same shape as the weighted test, every edge weighs 1
+    some.link(0, 1);
+    some.link(0, 3);
+    some.link(1, 4);
+    some.link(1, 3);
+    some.link(2, 0);
+    some.link(2, 5);
+    some.link(3, 2);
+    some.link(3, 4);
+    some.link(3, 5);
+    some.link(3, 6);
+    some.link(4, 6);
+    some.link(6, 5);
+
+    REQUIRE(some.is_adjacent(0, 1) == true);
+    REQUIRE(some.is_adjacent(1, 0) == false);
+    REQUIRE(some.distance(0, 1) == 1);
+    REQUIRE(some.distance(0, 6) == Graph::NO_EDGE);
+    REQUIRE(some.out_degree(3) == 4);
+    some.link(0, 6);
+    REQUIRE(some.is_adjacent(0, 6) == true);
+    some.unlink(0, 6);
+    REQUIRE(some.is_adjacent(0, 6) == false);
+    REQUIRE(some.out_degree(0) == 2);
+
+    std::ostringstream buf;
+    auto action = [&](const auto& v)
+    { buf << v << " "; };
+
+    some.depth_first_search(0, action);
+    REQUIRE(buf.str() == "0 1 3 2 5 4 6 ");
+    buf.str("");
+
+    some.breadth_first_search(0, action);
+    REQUIRE(buf.str() == "0 1 3 4 2 5 6 ");
+    buf.str("");
+
+    auto [level, parent] = some.breadth_first_levels(0);
+    REQUIRE(level == std::vector<Graph::V>{0, 1, 2, 1, 2, 2, 2});
+    REQUIRE(parent == std::vector<Graph::V>{-1, 0, 3, 0, 1, 3, 3});
+
+    auto [dist, path] = some.dijkstra(0);
+    REQUIRE(dist == std::vector<Graph::E>{0, 1, 2, 1, 2, 2, 2});
+    REQUIRE(path == std::vector<Graph::V>{-1, 0, 3, 0, 1, 3, 3});
+
+    std::ostringstream oss;
+    oss << some;
+    REQUIRE(oss.str() == "\
+Graph(\n\
+0 -> 1(1) 3(1) \n\
+1 -> 3(1) 4(1) \n\
+2 -> 0(1) 5(1) \n\
+3 -> 2(1) 4(1) 5(1) 6(1) \n\
+4 -> 6(1) \n\
+5 -> \n\
+6 -> 5(1) \n\
+)");
+
+    // rows that span several words
+    MatrixGraph<false, false> ring(200);
+    for (int v = 0; v < 200; v++)
+    {
+        ring.link(v, (v + 1) % 200);
+    }
+    REQUIRE(ring.is_adjacent(199, 0));
+    REQUIRE(ring.is_adjacent(64, 63));
+    REQUIRE(ring.out_degree(127) == 2);
+    int count = 0;
+    int last = -1;
+    ring.breadth_first_search(0, [&](auto v)
+                              { count++, last = int(v); });
+    REQUIRE(count == 200);
+    REQUIRE(last == 100);
+    REQUIRE(ring.dijkstra(0).first[100] == 100);
+
+    // a long path, deeper than the recursion would allow
+    MatrixGraph<true, false> chain(20000);
+    for (int v = 0; v + 1 < 20000; v++)
+    {
+        chain.link(v, v + 1);
+    }
+    int pre_count = 0;
+    int post_first = -1;
+    chain.depth_first_search(0, [&](auto)
+                            { pre_count++; }, [&](auto v)
+                            { post_first = post_first == -1 ? int(v) : post_first; });
+    REQUIRE(pre_count == 20000);
+    REQUIRE(post_first == 19999);
+    REQUIRE(chain.has_cycle() == false);
+    REQUIRE(chain.topological_sort()[19999] == 19999);
+    REQUIRE(chain.strongly_connected_components()[19999] == 19999);
+    chain.link(19999, 0);
+    REQUIRE(chain.has_cycle() == true);
+    REQUIRE(chain.strongly_connected_components() == std::vector<Graph::V>(20000, 0));
+
+    // undirected cycles
+    REQUIRE(ring.has_cycle() == true);
+    ring.unlink(0, 199);
+    REQUIRE(ring.has_cycle() == false);
+    REQUIRE(ring.strongly_connected_components() == std::vector<Graph::V>(200, 0));
+    ring.unlink(100, 101);
+    auto halves = ring.strongly_connected_components();
+    REQUIRE(halves[0] == halves[100]);
+    REQUIRE(halves[0] != halves[101]);
+    ring.link(7, 7);
+    REQUIRE(ring.has_cycle() == true);
+
+    some.clear();
+    REQUIRE(some == empty);
+}
+
+template <bool Directed, bool Weighted>
+void test_levels()
+{
+    // a chain into a hub with 1000 spokes and a chain out of the last spoke,
+    // so the search goes top-down, bottom-up at the hub, and top-down again
+    MatrixGraph<Directed, Weighted> graph(1100);
+    for (int v = 0; v < 9; v++)
+    {
+        graph.link(v, v + 1);
+    }
+    for (int v = 10; v < 1010; v++)
+    {
+        graph.link(9, v);
+    }
+    for (int v = 1009; v < 1099; v++)
+    {
+        graph.link(v, v + 1);
+    }
+
+    auto expected_level = [](int v)
+    { return v < 10 ? v : v < 1010 ? 10 : v - 999; };
+    auto expected_parent = [](int v)
+    { return v == 0 ? -1 : v < 10 || v > 1009 ? v - 1 : 9; };
+
+    auto [level, parent] = graph.breadth_first_levels(0);
+    for (int v = 0; v < 1100; v++)
+    {
+        REQUIRE(level[v] == expected_level(v));
+        REQUIRE(parent[v] == expected_parent(v));
+    }
+
+    // a vertex may get any parent on the previous level when run in parallel
+    common::ThreadPool pool(4);
+    graph.link(1098, 1000);
+    auto [plevel, pparent] = graph.breadth_first_levels(pool, 0);
+    REQUIRE(plevel == graph.breadth_first_levels(0).first);
+    for (int v = 1; v < 1100; v++)
+    {
+        REQUIRE(plevel[pparent[v]] == plevel[v] - 1);
+        REQUIRE(graph.is_adjacent(pparent[v], v));
+    }
+
+    // unreachable vertices
+    auto [tail_level, tail_parent] = graph.breadth_first_levels(pool, 1050);
+    REQUIRE(tail_level[1099] == (Directed ? 49 : 45));
+    REQUIRE(tail_level[0] == (Directed ? -1 : 51));
+    REQUIRE(tail_parent[1050] == -1);
+}
+
+TEST_CASE("MatrixGraph copy and move")
+{
+    MatrixGraph<> graph(5);
+    graph.link(0, 1, 7);
+    graph.link(3, 4, 2);
+
+    // copies own their matrices
+    MatrixGraph<> copy = graph;
+    copy.link(1, 2, 3);
+    REQUIRE(graph.is_adjacent(1, 2) == false);
+    REQUIRE(copy.distance(0, 1) == 7);
+    copy = graph;
+    REQUIRE(copy == graph);
+    auto& alias = copy;
+    copy = alias;
+    REQUIRE(copy == graph);
+    copy = MatrixGraph<>();
+    REQUIRE(copy.is_empty() == true);
+    copy.set_vertex_number(3);
+    REQUIRE(copy == MatrixGraph<>(3));
+
+    MatrixGraph<> moved = std::move(graph);
+    REQUIRE(moved.distance(3, 4) == 2);
+    REQUIRE(graph.is_empty() == true);
+    graph = std::move(moved);
+    REQUIRE(graph.distance(0, 1) == 7);
+    REQUIRE(moved.is_empty() == true);
+
+    // bit-packed
+    MatrixGraph<true, false> bits(100);
+    bits.link(3, 99);
+    MatrixGraph<true, false> bits_copy = bits;
+    bits_copy.unlink(3, 99);
+    REQUIRE(bits.is_adjacent(3, 99) == true);
+    REQUIRE(bits_copy.is_adjacent(3, 99) == false);
+    bits_copy.set_vertex_number(200);
+    bits_copy.link(150, 199);
+    REQUIRE(bits_copy.is_adjacent(150, 199) == true);
+    REQUIRE(bits_copy.is_adjacent(3, 99) == false);
+}
+
+TEST_CASE("MatrixGraph breadth-first levels")
+{
+    test_levels<true, true>();
+    test_levels<true, false>();
+    test_levels<false, true>();
+    test_levels<false, false>();
+}
+
+TEST_CASE("MatrixGraph all-pairs shortest paths")
+{
+    // several tiles with a partial one, sparse enough to leave vertices unreachable
+    const int n = 150;
+    MatrixGraph graph(n);
+    for (int u = 0; u < n; u++)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            if (u != v && (u * 37 + v * 91) % 23 == 0)
+            {
+                graph.link(u, v, (u * 13 + v * 7) % 50 + 1);
+            }
+        }
+    }
+    graph.unlink(42, 73);
+    for (int u = 0; u < n; u++)
+    {
+        graph.unlink(u, 42);
+    }
+
+    common::ThreadPool pool(4);
+    auto [dist, path] = graph.all_pairs_shortest_paths(pool);
+    REQUIRE(graph.all_pairs_shortest_paths() == std::pair{dist, path});
+    REQUIRE(graph.johnson(pool).first == dist);
+    for (int u = 0; u < n; u++)
+    {
+        REQUIRE(dist[u] == graph.dijkstra(u).first);
+        for (int v = 0; v < n; v++)
+        {
+            if (u == v || dist[u][v] == MatrixGraph<>::NO_EDGE)
+            {
+                REQUIRE(path[u][v] == -1);
+            }
+            else
+            {
+                REQUIRE(dist[u][path[u][v]] + graph.distance(path[u][v], v) == dist[u][v]);
+            }
+        }
+    }
+    REQUIRE(dist[0][42] == MatrixGraph<>::NO_EDGE);
+
+    // negative weights
+    MatrixGraph<> rebate(4);
+    rebate.link(0, 1, 4);
+    rebate.link(0, 2, 1);
+    rebate.link(2, 1, -2);
+    rebate.link(1, 3, 1);
+    auto [rebate_dist, rebate_path] = rebate.all_pairs_shortest_paths();
+    REQUIRE(rebate_dist[0] == std::vector<MatrixGraph<>::E>{0, -1, 1, 0});
+    REQUIRE(rebate_path[0] == std::vector<MatrixGraph<>::V>{-1, 2, 0, 1});
+    REQUIRE(rebate_dist[3] == std::vector<MatrixGraph<>::E>{MatrixGraph<>::NO_EDGE, MatrixGraph<>::NO_EDGE, MatrixGraph<>::NO_EDGE, 0});
+    REQUIRE_THROWS_MATCHES(rebate.dijkstra(0), std::runtime_error, Message("Error: Cannot apply Dijkstra algorithm with a negative weighted egde."));
+    REQUIRE(rebate.bellman_ford(0) == std::pair{rebate_dist[0], rebate_path[0]});
+    REQUIRE(rebate.johnson() == std::pair{rebate_dist, rebate_path});
+
+    // a negative cycle 1 -> 2 -> 1, which vertex 3 cannot reach
+    rebate.link(1, 2, 1);
+    REQUIRE_THROWS_MATCHES(rebate.all_pairs_shortest_paths(), std::runtime_error, Message("Error: Cannot find shortest paths with a negative cycle."));
+    REQUIRE_THROWS_MATCHES(rebate.bellman_ford(0), std::runtime_error, Message("Error: Cannot find shortest paths with a negative cycle."));
+    REQUIRE_THROWS_MATCHES(rebate.johnson(), std::runtime_error, Message("Error: Cannot find shortest paths with a negative cycle."));
+    REQUIRE(rebate.bellman_ford(3).first == std::vector<MatrixGraph<>::E>{MatrixGraph<>::NO_EDGE, MatrixGraph<>::NO_EDGE, MatrixGraph<>::NO_EDGE, 0});
+
+    // large weights, the sums that would overflow saturate to no edge instead of wrapping to a negative cycle
+    const int far = 1000000000;
+    MatrixGraph<false> line(20);
+    for (int v = 0; v + 1 < 20; v++)
+    {
+        line.link(v, v + 1, far);
+    }
+    auto [line_dist, line_path] = line.all_pairs_shortest_paths(pool);
+    for (int u = 0; u < 20; u++)
+    {
+        for (int v = 0; v < 20; v++)
+        {
+            int hops = std::abs(u - v);
+            REQUIRE(line_dist[u][v] == (hops <= 2 ? hops * far : MatrixGraph<>::NO_EDGE));
+            REQUIRE(line_path[u][v] == (hops == 0 || hops > 2 ? -1 : u < v ? v - 1 : v + 1));
+        }
+    }
+    REQUIRE(line.johnson(pool) == std::pair{line_dist, line_path});
+    REQUIRE(line.bellman_ford(0) == std::pair{line_dist[0], line_path[0]});
+
+    // near INT_MAX weights with a negative edge
+    MatrixGraph<> edge(4);
+    edge.link(0, 1, INT_MAX - 1);
+    edge.link(1, 2, -5);
+    edge.link(2, 3, 10);
+    edge.link(1, 3, 1);
+    auto [edge_dist, edge_path] = edge.all_pairs_shortest_paths();
+    REQUIRE(edge_dist[0] == std::vector<MatrixGraph<>::E>{0, INT_MAX - 1, INT_MAX - 6, MatrixGraph<>::NO_EDGE});
+    REQUIRE(edge_path[0] == std::vector<MatrixGraph<>::V>{-1, 0, 1, -1});
+    REQUIRE(edge_dist[1][3] == 1);
+    REQUIRE(edge.johnson() == std::pair{edge_dist, edge_path});
+    REQUIRE(edge.bellman_ford(0) == std::pair{edge_dist[0], edge_path[0]});
+
+    // unweighted
+    MatrixGraph<false, false> ring(100);
+    for (int v = 0; v < 100; v++)
+    {
+        ring.link(v, (v + 1) % 100);
+    }
+    auto ring_dist = ring.all_pairs_shortest_paths(pool).first;
+    REQUIRE(ring_dist[3][97] == 6);
+    REQUIRE(ring_dist[10][60] == 50);
+    REQUIRE(ring.johnson(pool).first == ring_dist);
+}
+
+TEST_CASE("MatrixGraph minimum spanning tree")
+{
+    using Edges = std::vector<std::pair<MatrixGraph<>::V, MatrixGraph<>::V>>;
+
+    // the weighted test graph, undirected
+    MatrixGraph<false> graph(7);
+    graph.link(0, 1, 2);
+    graph.link(0, 3, 1);
+    graph.link(1, 4, 10);
+    graph.link(1, 3, 3);
+    graph.link(2, 0, 4);
+    graph.link(2, 5, 5);
+    graph.link(3, 2, 2);
+    graph.link(3, 4, 2);
+    graph.link(3, 5, 8);
+    graph.link(3, 6, 4);
+    graph.link(4, 6, 6);
+    graph.link(6, 5, 1);
+
+    REQUIRE(graph.prim() == std::pair{12LL, Edges{{0, 3}, {0, 1}, {2, 3}, {3, 4}, {3, 6}, {5, 6}}});
+    REQUIRE(graph.kruskal() == std::pair{12LL, Edges{{0, 3}, {5, 6}, {0, 1}, {2, 3}, {3, 4}, {3, 6}}});
+    auto [total, edges] = graph.boruvka();
+    std::sort(edges.begin(), edges.end());
+    REQUIRE(total == 12);
+    REQUIRE(edges == Edges{{0, 1}, {0, 3}, {2, 3}, {3, 4}, {3, 6}, {5, 6}});
+
+    REQUIRE(MatrixGraph<false>().prim() == std::pair{0LL, Edges{}});
+    REQUIRE(MatrixGraph<false>().kruskal() == std::pair{0LL, Edges{}});
+    REQUIRE(MatrixGraph<false>().boruvka() == std::pair{0LL, Edges{}});
+
+    // several components with many equal weights
+    const int n = 150;
+    MatrixGraph<false> big(n);
+    for (int u = 0; u < n; u++)
+    {
+        for (int v = u + 1; v < n; v++)
+        {
+            if ((u * 37 + v * 91) % 23 == 0 && u % 50 != 0 && v % 50 != 0)
+            {
+                big.link(u, v, (u * 13 + v * 7) % 5 - 2);
+            }
+        }
+    }
+    common::ThreadPool pool(4);
+    auto [prim_total, prim_edges] = big.prim();
+    auto [kruskal_total, kruskal_edges] = big.kruskal();
+    auto [boruvka_total, boruvka_edges] = big.boruvka(pool);
+    REQUIRE(prim_total == kruskal_total);
+    REQUIRE(boruvka_total == kruskal_total);
+    REQUIRE(prim_edges.size() == kruskal_edges.size());
+    REQUIRE(boruvka_edges.size() == kruskal_edges.size());
+    REQUIRE(kruskal_edges.size() < n - 3); // vertices 0, 50 and 100 are isolated
+
+    DisjointSet forest(n);
+    for (auto [u, v] : boruvka_edges)
+    {
+        REQUIRE(big.is_adjacent(u, v));
+        REQUIRE(forest.unite(u, v));
+    }
+
+    // unweighted
+    MatrixGraph<false, false> ring(100);
+    for (int v = 0; v < 100; v++)
+    {
+        ring.link(v, (v + 1) % 100);
+    }
+    REQUIRE(ring.prim().first == 99);
+    REQUIRE(ring.kruskal().second.size() == 99);
+    REQUIRE(ring.boruvka(pool).first == 99);
+
+    // the total of large weights does not fit in E
+    MatrixGraph<false> heavy(10);
+    for (int v = 0; v < 10; v++)
+    {
+        heavy.link(v, (v + 1) % 10, 1000000000 + v);
+    }
+    REQUIRE(heavy.prim().first == 9000000036LL);
+    REQUIRE(heavy.kruskal().first == 9000000036LL);
+    REQUIRE(heavy.boruvka(pool).first == 9000000036LL);
+}
+
+TEST_CASE("MatrixGraph point-to-point shortest paths")
+{
+    // a 20 x 20 grid with some walls, the Manhattan distance is admissible
+    const int side = 20;
+    MatrixGraph<false> grid(side * side);
+    auto is_wall = [](int x, int y)
+    { return (x == 5 && y < 15) || (x == 12 && y > 3); };
+    for (int x = 0; x < side; x++)
+    {
+        for (int y = 0; y < side; y++)
+        {
+            if (x + 1 < side && !is_wall(x, y) && !is_wall(x + 1, y))
+            {
+                grid.link(x * side + y, (x + 1) * side + y, 1 + (x + y) % 3);
+            }
+            if (y + 1 < side && !is_wall(x, y) && !is_wall(x, y + 1))
+            {
+                grid.link(x * side + y, x * side + y + 1, 1 + (x + y) % 3);
+            }
+        }
+    }
+
+    for (int start : {0, 21, 399, 250})
+    {
+        auto dist = grid.dijkstra(start).first;
+        for (int goal = 0; goal < side * side; goal += 7)
+        {
+            auto manhattan = [&](auto v)
+            { return std::abs(int(v) / side - goal / side) + std::abs(int(v) % side - goal % side); };
+            auto [astar_dist, astar_path] = grid.astar(start, goal, manhattan);
+            auto [bidi_dist, bidi_path] = grid.bidirectional_dijkstra(start, goal);
+            REQUIRE(astar_dist == dist[goal]);
+            REQUIRE(bidi_dist == dist[goal]);
+            for (const auto& path : {astar_path, bidi_path})
+            {
+                if (dist[goal] == MatrixGraph<>::NO_EDGE)
+                {
+                    REQUIRE(path.empty());
+                    continue;
+                }
+                REQUIRE(path.front() == start);
+                REQUIRE(path.back() == goal);
+                int length = 0;
+                for (std::size_t i = 1; i < path.size(); i++)
+                {
+                    length += grid.distance(path[i - 1], path[i]);
+                }
+                REQUIRE(length == dist[goal]);
+            }
+        }
+    }
+
+    // directed and unweighted
+    MatrixGraph<true, false> chain(300);
+    for (int v = 0; v + 1 < 300; v++)
+    {
+        chain.link(v, v + 1);
+    }
+    chain.link(10, 200);
+    REQUIRE(chain.bidirectional_dijkstra(0, 250).first == 61);
+    REQUIRE(chain.bidirectional_dijkstra(250, 0).first == MatrixGraph<>::NO_EDGE);
+    REQUIRE(chain.astar(0, 250, [](auto) { return 0; }).second.size() == 62);
+
+    MatrixGraph<> rebate(3);
+    rebate.link(0, 1, 1);
+    rebate.link(1, 2, -1);
+    REQUIRE_THROWS_MATCHES(rebate.bidirectional_dijkstra(0, 2), std::runtime_error, Message("Error: Cannot apply Dijkstra algorithm with a negative weighted egde."));
+
+    // distances past INT_MAX saturate to NO_EDGE instead of overflowing
+    using Route = std::pair<MatrixGraph<>::E, std::vector<MatrixGraph<>::V>>;
+    MatrixGraph<> heavy(20);
+    for (int v = 0; v + 1 < 20; v++)
+    {
+        heavy.link(v, v + 1, 1000000000);
+    }
+    REQUIRE(heavy.astar(0, 2, [](auto) { return 0; }) == Route{2000000000, {0, 1, 2}});
+    REQUIRE(heavy.bidirectional_dijkstra(0, 2) == Route{2000000000, {0, 1, 2}});
+    for (int v = 3; v < 20; v++)
+    {
+        REQUIRE(heavy.astar(0, v, [](auto) { return 0; }) == Route{MatrixGraph<>::NO_EDGE, {}});
+        REQUIRE(heavy.bidirectional_dijkstra(0, v) == Route{MatrixGraph<>::NO_EDGE, {}});
+        REQUIRE(heavy.bidirectional_dijkstra(v - 2, v).first == 2000000000);
+    }
+}
+
+TEST_CASE("MatrixGraph search workspace")
+{
+    STATIC_REQUIRE(std::is_copy_constructible_v<SearchWorkspace> == false);
+    STATIC_REQUIRE(std::is_copy_assignable_v<SearchWorkspace> == false);
+
+    SearchWorkspace workspace;
+    REQUIRE_THROWS_MATCHES(workspace.distance(0), std::runtime_error, Message("Error: Index out of range."));
+
+    // one workspace reused across graphs of different sizes, the results must match fresh searches
+    for (int n : {50, 7, 120, 1, 64})
+    {
+        MatrixGraph<> graph(n);
+        for (int u = 0; u < n; u++)
+        {
+            for (int step : {1, 3, 11})
+            {
+                if ((u * step + n) % 4 != 0)
+                {
+                    graph.link(u, (u * step + step) % n, 1 + (u + step) % 9);
+                }
+            }
+        }
+
+        for (int start = 0; start < n; start += 5)
+        {
+            std::vector<int> expected, actual;
+            auto record = [](std::vector<int>& order)
+            { return [&order](auto v) { order.push_back(int(v)); }; };
+
+            graph.depth_first_search(start, record(expected), record(expected));
+            graph.depth_first_search(workspace, start, record(actual), record(actual));
+            REQUIRE(actual == expected);
+
+            expected.clear();
+            actual.clear();
+            graph.breadth_first_search(start, record(expected));
+            graph.breadth_first_search(workspace, start, record(actual));
+            REQUIRE(actual == expected);
+
+            auto [dist, path] = graph.dijkstra(start);
+            graph.dijkstra(workspace, start);
+            for (int v = 0; v < n; v++)
+            {
+                REQUIRE(workspace.distance(v) == dist[v]);
+                if (dist[v] != MatrixGraph<>::NO_EDGE && v != start)
+                {
+                    REQUIRE(workspace.distance(workspace.previous(v)) + graph.distance(workspace.previous(v), v) == dist[v]);
+                }
+            }
+            REQUIRE(workspace.previous(start) == -1);
+            REQUIRE_THROWS_MATCHES(workspace.distance(n), std::runtime_error, Message("Error: Index out of range."));
+
+            int goal = (start * 7 + 3) % n;
+            REQUIRE(graph.astar(workspace, start, goal, [](auto) { return 0; }).first == dist[goal]);
+            REQUIRE(graph.bidirectional_dijkstra(workspace, start, goal) == graph.bidirectional_dijkstra(start, goal));
+        }
+    }
+
+    // distances past INT_MAX saturate to NO_EDGE instead of overflowing
+    MatrixGraph<> heavy(20);
+    for (int v = 0; v + 1 < 20; v++)
+    {
+        heavy.link(v, v + 1, 1000000000);
+    }
+    auto [dist, path] = heavy.dijkstra(0);
+    heavy.dijkstra(workspace, 0);
+    for (int v = 0; v < 20; v++)
+    {
+        auto expected = v <= 2 ? v * 1000000000 : MatrixGraph<>::NO_EDGE;
+        REQUIRE(dist[v] == expected);
+        REQUIRE(path[v] == (v == 0 || v > 2 ? -1 : v - 1));
+        REQUIRE(workspace.distance(v) == expected);
+    }
+    REQUIRE(workspace.previous(2) == 1);
+}
@@ -113,4 +113,15 @@ TEST_CASE("BinaryHeap")
     BinaryHeap<EqLtType, std::less<EqLtType>> some = {EqLtType(), EqLtType(), EqLtType(), EqLtType(), EqLtType()};
     REQUIRE(empty.size() == 0);
     REQUIRE(some.size() == 5);
+
+    // pop in order after pushes in scrambled order
+    BinaryHeap<int, std::less<int>> heap;
+    for (int i = 0; i < 100; i++)
+    {
+        heap.push(i * 37 % 100);
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(heap.pop() == i);
+    }
 }
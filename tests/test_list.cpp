@@ -2,7 +2,9 @@
 
 #include "../sources/List/ArrayList.hpp"
 #include "../sources/List/LinkedList.hpp"
+#include "../sources/List/SmallArrayList.hpp"
 #include "../sources/List/SinglyLinkedList.hpp"
+#include "../sources/common/ThreadPool.hpp"
 
 using namespace hellods;
 
@@ -93,6 +95,21 @@ void test()
 
     REQUIRE(some.reverse() == List({8, 6, 4, 2, 0}));
 
+    REQUIRE(some.sort() == List({0, 2, 4, 6, 8}));
+    REQUIRE(some.sort(std::greater<int>()) == List({8, 6, 4, 2, 0}));
+    REQUIRE(some.sort() == List({0, 2, 4, 6, 8}));
+
+    List odd = {1, 3, 5, 7};
+    List mixed = {0, 3, 4, 9};
+    REQUIRE(odd.merge(mixed) == List({0, 1, 3, 3, 4, 5, 7, 9}));
+    REQUIRE(mixed.is_empty());
+    REQUIRE(mixed.merge(odd) == List({0, 1, 3, 3, 4, 5, 7, 9}));
+    REQUIRE(odd.is_empty());
+    List fresh;
+    REQUIRE(fresh.merge(mixed) == List({0, 1, 3, 3, 4, 5, 7, 9}));
+    REQUIRE(fresh.merge(fresh) == List({0, 1, 3, 3, 4, 5, 7, 9}));
+    REQUIRE(fresh.merge(odd).size() == 8);
+
     some.clear();
     REQUIRE(some == empty);
     some.clear(); // double clear
@@ -124,6 +141,439 @@ TEST_CASE("ArrayList")
     REQUIRE(some.size() == 5);
 }
 
+TEST_CASE("ArrayList iterator")
+{
+    using It = ArrayList<int>::Iterator;
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>);
+
+    ArrayList<int> list = {5, 3, 9, 1, 7, 2, 8};
+    It first = list.begin();
+    It last = list.end();
+
+    // arithmetic and comparison
+    REQUIRE(last - first == 7);
+    REQUIRE(std::distance(first, last) == 7);
+    REQUIRE(first + 7 == last);
+    REQUIRE(7 + first == last);
+    REQUIRE(last - 7 == first);
+    REQUIRE(first[2] == 9);
+    REQUIRE(first < last);
+    REQUIRE(last > first);
+    REQUIRE(first <= first);
+    REQUIRE(last >= last);
+    It it = first;
+    it += 3;
+    REQUIRE(*it == 1);
+    it -= 2;
+    REQUIRE(*it == 3);
+    REQUIRE(It() == It());
+
+    // std algorithms that require random access
+    std::sort(list.begin(), list.end());
+    REQUIRE(list == ArrayList<int>({1, 2, 3, 5, 7, 8, 9}));
+    REQUIRE(std::lower_bound(list.begin(), list.end(), 6) - list.begin() == 4);
+    REQUIRE(std::binary_search(list.begin(), list.end(), 8));
+    std::nth_element(list.begin(), list.begin() + 3, list.end(), std::greater<int>());
+    REQUIRE(list[3] == 5);
+    REQUIRE(&*list.begin() + 6 == &*(list.end() - 1)); // contiguous
+}
+
+TEST_CASE("ArrayList bulk")
+{
+    ArrayList<int> list = {1, 2, 3};
+    ArrayList<int> other = {7, 8, 9, 10, 11, 12, 13, 14};
+
+    list.insert(1, other.begin(), other.end());
+    REQUIRE(list == ArrayList<int>({1, 7, 8, 9, 10, 11, 12, 13, 14, 2, 3}));
+    list.insert(list.size(), other.begin(), other.begin());
+    REQUIRE(list.size() == 11);
+    REQUIRE_THROWS_MATCHES(list.insert(12, other.begin(), other.end()), std::runtime_error, Message("Error: Index out of range."));
+
+    // a range of the list itself, also when the insertion reallocates
+    ArrayList<int> self = {1, 2, 3};
+    self.insert(1, self.begin(), self.end());
+    REQUIRE(self == ArrayList<int>({1, 1, 2, 3, 2, 3}));
+    self.insert(0, self.begin() + 4, self.end());
+    REQUIRE(self == ArrayList<int>({2, 3, 1, 1, 2, 3, 2, 3}));
+    self.insert(8, self.begin(), self.begin());
+    REQUIRE(self.size() == 8);
+
+    // a single-pass range
+    std::istringstream iss("4 5 6");
+    self.insert(2, std::istream_iterator<int>(iss), std::istream_iterator<int>());
+    REQUIRE(self == ArrayList<int>({2, 3, 4, 5, 6, 1, 1, 2, 3, 2, 3}));
+
+    list.erase(1, 9);
+    REQUIRE(list == ArrayList<int>({1, 2, 3}));
+    list.erase(0, 0);
+    REQUIRE(list == ArrayList<int>({1, 2, 3}));
+    REQUIRE_THROWS_MATCHES(list.erase(2, 1), std::runtime_error, Message("Error: Index out of range."));
+    REQUIRE_THROWS_MATCHES(list.erase(0, 4), std::runtime_error, Message("Error: Index out of range."));
+
+    REQUIRE(other.remove_if([](int e)
+                            { return e % 2 == 0; }) == 4);
+    REQUIRE(other == ArrayList<int>({7, 9, 11, 13}));
+    REQUIRE(other.retain([](int e)
+                         { return e > 10; }) == 2);
+    REQUIRE(other == ArrayList<int>({11, 13}));
+
+    ArrayList<std::string> words = {"c", "d"};
+    std::string front[] = {"a", "b"};
+    words.insert(0, front, front + 2);
+    REQUIRE(words == ArrayList<std::string>({"a", "b", "c", "d"}));
+    words.erase(1, 3);
+    REQUIRE(words == ArrayList<std::string>({"a", "d"}));
+}
+
+TEST_CASE("ArrayList parallel")
+{
+    common::ThreadPool pool(4);
+
+    ArrayList<int> small = {1, 2, 3, 4, 5};
+    REQUIRE(small.map(pool, [](auto& e)
+                      { e *= 2; }) == ArrayList<int>({2, 4, 6, 8, 10}));
+    REQUIRE(small.reverse(pool) == ArrayList<int>({10, 8, 6, 4, 2}));
+    REQUIRE(*small.find(pool, 6) == 6);
+    REQUIRE(small.find(pool, 7) == small.end());
+
+    const int n = 100001;
+    ArrayList<int> big;
+    for (int i = 0; i < n; i++)
+    {
+        big.insert(i, i);
+    }
+
+    big.map(pool, [](auto& e)
+            { e *= 2; });
+    bool all_doubled = true;
+    for (int i = 0; i < n; i++)
+    {
+        all_doubled = all_doubled && big[i] == i * 2;
+    }
+    REQUIRE(all_doubled);
+
+    REQUIRE(big.find(pool, 0) == big.begin());
+    REQUIRE(*big.find(pool, 2 * 77777) == 2 * 77777);
+    REQUIRE(big.find(pool, 1) == big.end());
+    big[n - 1] = 0; // duplicate, should still find the first one
+    REQUIRE(big.find(pool, 0) == big.begin());
+
+    big.reverse(pool);
+    bool all_reversed = big[0] == 0;
+    for (int i = 1; i < n; i++)
+    {
+        all_reversed = all_reversed && big[i] == (n - 1 - i) * 2;
+    }
+    REQUIRE(all_reversed);
+
+    REQUIRE_THROWS_MATCHES(big.map(pool, [](auto& e)
+                                   { if (e == 4) throw std::runtime_error("Error: Test."); }),
+                           std::runtime_error, Message("Error: Test."));
+}
+
+template <typename T>
+void test_search()
+{
+    // every position of lists of every length up to two AVX2 blocks plus a tail
+    for (int n = 0; n <= 70; n++)
+    {
+        ArrayList<T> list;
+        for (int i = 0; i < n; i++)
+        {
+            list.insert(i, T(i % 60 + 1));
+        }
+
+        bool all_found = true;
+        for (int i = 0; i < n && i < 60; i++)
+        {
+            all_found = all_found && std::distance(list.begin(), list.find(T(i + 1))) == i && list.contains(T(i + 1)) && list.count(T(i + 1)) == (i + 60 < n ? 2 : 1);
+        }
+        REQUIRE(all_found);
+        REQUIRE(list.find(T(0)) == list.end());
+        REQUIRE(list.contains(T(0)) == false);
+        REQUIRE(list.count(T(0)) == 0);
+
+        if (n > 0)
+        {
+            REQUIRE(list.min() == T(1));
+            REQUIRE(list.max() == T(n < 60 ? n : 60));
+        }
+    }
+}
+
+TEST_CASE("ArrayList search")
+{
+    test_search<int>();
+    test_search<char>();
+    test_search<short>();
+    test_search<unsigned long long>();
+    test_search<float>();
+    test_search<double>();
+
+    ArrayList<int> list = {3, -1, 4, -1, 5, 9, -2, 6};
+    REQUIRE(list.count(-1) == 2);
+    REQUIRE(list.min() == -2);
+    REQUIRE(list.max() == 9);
+    REQUIRE_THROWS_MATCHES(ArrayList<int>().min(), std::runtime_error, Message("Error: The container is empty."));
+    REQUIRE_THROWS_MATCHES(ArrayList<int>().max(), std::runtime_error, Message("Error: The container is empty."));
+
+    ArrayList<std::string> strings = {"b", "a", "c", "a"};
+    REQUIRE(std::distance(strings.begin(), strings.find("a")) == 1);
+    REQUIRE(strings.count("a") == 2);
+    REQUIRE(strings.min() == "a");
+    REQUIRE(strings.max() == "c");
+}
+
+TEST_CASE("ArrayList shrink")
+{
+    test<ArrayList<int, common::QuarterShrink>>();
+
+    // never shrink automatically by default
+    ArrayList<int> list;
+    for (int i = 0; i < 1000; i++)
+    {
+        list.insert(i, i);
+    }
+    int peak = list.capacity();
+    list.erase(10, 1000);
+    REQUIRE(list.capacity() == peak);
+    list.shrink_to_fit();
+    REQUIRE(list.capacity() == 10);
+    REQUIRE(list == ArrayList<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    list.clear();
+    list.shrink_to_fit();
+    REQUIRE(list.capacity() == 0);
+    list.insert(0, 1);
+    REQUIRE(list == ArrayList<int>({1}));
+
+    // halve while less than a quarter is used, but not below the initial capacity
+    ArrayList<int, common::QuarterShrink> shrinking;
+    for (int i = 0; i < 1024; i++)
+    {
+        shrinking.insert(i, i);
+    }
+    REQUIRE(shrinking.capacity() == 1024);
+    while (shrinking.size() > 256)
+    {
+        shrinking.remove(shrinking.size() - 1);
+    }
+    REQUIRE(shrinking.capacity() == 1024);
+    shrinking.remove(shrinking.size() - 1);
+    REQUIRE(shrinking.capacity() == 512);
+    REQUIRE(shrinking.remove_if([](int e)
+                                { return e >= 10; }) == 245);
+    REQUIRE(shrinking.capacity() == 32);
+    REQUIRE(shrinking[9] == 9);
+    shrinking.clear();
+    REQUIRE(shrinking.capacity() == 8);
+
+    // a small list moves back into its inline buffer
+    SmallArrayList<int, 4> small = {1, 2, 3, 4, 5};
+    REQUIRE(small.is_inline() == false);
+    small.remove(4);
+    small.shrink_to_fit();
+    REQUIRE(small.is_inline());
+    REQUIRE(small == ArrayList<int>({1, 2, 3, 4}));
+}
+
+TEST_CASE("ArrayList growth")
+{
+    test<ArrayList<int, common::NoShrink, common::HalfGrowth>>();
+    test<ArrayList<int, common::NoShrink, common::FixedGrowth<5>>>();
+    test<ArrayList<int, common::QuarterShrink, common::SizeClassGrowth>>();
+
+    // the capacities that a list goes through while appending
+    auto capacities = [](auto list)
+    {
+        ArrayList<int> result;
+        for (int i = 0; i < 50; i++)
+        {
+            list.insert(list.size(), i);
+            if (result.is_empty() || result[result.size() - 1] != list.capacity())
+            {
+                result.insert(result.size(), list.capacity());
+            }
+        }
+        return result;
+    };
+    REQUIRE(capacities(ArrayList<int>()) == ArrayList<int>({8, 16, 32, 64}));
+    REQUIRE(capacities(ArrayList<int, common::NoShrink, common::HalfGrowth>()) == ArrayList<int>({8, 13, 20, 31, 47, 71}));
+    REQUIRE(capacities(ArrayList<int, common::NoShrink, common::FixedGrowth<20>>()) == ArrayList<int>({8, 28, 48, 68}));
+    REQUIRE(capacities(ArrayList<int, common::NoShrink, common::SizeClassGrowth>()) == ArrayList<int>({8, 16, 28, 48, 80}));
+
+    REQUIRE(common::SizeClassGrowth::size_class(1) == 8);
+    REQUIRE(common::SizeClassGrowth::size_class(9) == 16);
+    REQUIRE(common::SizeClassGrowth::size_class(100) == 112);
+    REQUIRE(common::SizeClassGrowth::size_class(128) == 128);
+    REQUIRE(common::SizeClassGrowth::size_class(129) == 160);
+    REQUIRE(common::SizeClassGrowth::size_class(257) == 320);
+    REQUIRE(common::SizeClassGrowth::size_class(4097) == 5120);
+
+    // bulk insertion still reserves enough at once
+    ArrayList<int, common::NoShrink, common::FixedGrowth<1>> fixed;
+    ArrayList<int> source = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    fixed.insert(0, source.begin(), source.end());
+    REQUIRE(fixed.capacity() == 12);
+    REQUIRE(fixed[11] == 12);
+}
+
+TEST_CASE("SmallArrayList")
+{
+    test<SmallArrayList<int, 4>>();
+    test<SmallArrayList<int, 8>>();
+
+    SmallArrayList<int, 4> list = {1, 2, 3};
+    REQUIRE(list.is_inline());
+    list.insert(3, 4);
+    REQUIRE(list.is_inline());
+    list.insert(4, 5); // spill to the heap
+    REQUIRE(list.is_inline() == false);
+    REQUIRE(list == ArrayList<int>({1, 2, 3, 4, 5}));
+
+    SmallArrayList<int, 4> copy = list; // copies own their storage
+    copy[0] = 0;
+    REQUIRE(list[0] == 1);
+    SmallArrayList<int, 4> small = {6};
+    copy = small;
+    REQUIRE(copy == ArrayList<int>({6}));
+    small = list;
+    REQUIRE(small == list);
+    REQUIRE(small.is_inline() == false);
+
+    SmallArrayList<std::string, 2> strings = {"a", "b", "c"};
+    REQUIRE(strings.count("b") == 1);
+    REQUIRE(strings.remove(0) == "a");
+    REQUIRE(strings.size() == 2);
+}
+
+TEST_CASE("List size type")
+{
+    // sizes, indices and iterator differences are pointer-sized, not limited to int
+    STATIC_REQUIRE(std::is_same_v<ArrayList<int>::size_type, std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(ArrayList<int>().size()), std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(ArrayList<int>().capacity()), std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(ArrayList<int>().count(0)), std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(LinkedList<int>().size()), std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<ArrayList<int>::Iterator>::difference_type, std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<LinkedList<int>::Iterator>::difference_type, std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<SinglyLinkedList<int>::Iterator>::difference_type, std::ptrdiff_t>);
+}
+
+TEST_CASE("List sort")
+{
+    // stable: equal keys keep their order
+    struct Item
+    {
+        int key;
+        int order;
+
+        bool operator==(const Item& that) const
+        {
+            return key == that.key && order == that.order;
+        }
+    };
+    auto by_key = [](const Item& a, const Item& b)
+    { return a.key < b.key; };
+
+    std::vector<Item> items;
+    std::vector<int> keys;
+    unsigned seed = 12345;
+    for (int i = 0; i < 3000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        items.push_back({int(seed >> 16) % 100, i});
+        keys.push_back(int(seed >> 8) - (1 << 23)); // negative keys too
+    }
+
+    LinkedList<Item> linked;
+    SinglyLinkedList<Item> singly;
+    for (int i = 0; i < 3000; i++)
+    {
+        linked.insert(i, items[i]);
+        singly.insert(i, items[i]);
+    }
+    std::stable_sort(items.begin(), items.end(), by_key);
+    linked.sort(by_key);
+    singly.sort(by_key);
+    REQUIRE(std::equal(items.begin(), items.end(), linked.begin()));
+    REQUIRE(std::equal(items.begin(), items.end(), singly.begin()));
+    REQUIRE(*--linked.end() == items.back()); // predecessors are relinked
+    REQUIRE(linked[1500] == items[1500]);
+
+    // radix sort for integral keys in ascending order, introsort for the others
+    ArrayList<int> array;
+    ArrayList<long long> wide;
+    ArrayList<unsigned char> bytes;
+    for (int i = 0; i < 3000; i++)
+    {
+        array.insert(i, keys[i]);
+        wide.insert(i, (long long)keys[i] * 1000003);
+        bytes.insert(i, (unsigned char)keys[i]);
+    }
+    std::vector<int> expected = keys;
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(std::equal(expected.begin(), expected.end(), array.sort().begin()));
+    REQUIRE(std::is_sorted(wide.sort().begin(), wide.end()));
+    REQUIRE(std::is_sorted(bytes.sort().begin(), bytes.end()));
+    REQUIRE(std::is_sorted(array.sort(std::greater<int>()).begin(), array.end(), std::greater<int>()));
+
+    // parallel merge sort
+    common::ThreadPool pool(4);
+    ArrayList<int> big;
+    std::vector<int> big_expected;
+    for (int i = 0; i < 100003; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        big.insert(i, int(seed >> 4));
+        big_expected.push_back(int(seed >> 4));
+    }
+    std::sort(big_expected.begin(), big_expected.end(), std::greater<int>());
+    big.sort(pool, std::greater<int>());
+    REQUIRE(std::equal(big_expected.begin(), big_expected.end(), big.begin()));
+    REQUIRE(std::is_sorted(big.sort(pool).begin(), big.end()));
+}
+
+TEST_CASE("List lazy allocation")
+{
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<ArrayList<int>>);
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<LinkedList<int>>);
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<SinglyLinkedList<int>>);
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<SmallArrayList<int, 4>>);
+
+    // operations on lists that have not allocated yet
+    ArrayList<int> array;
+    LinkedList<int> linked;
+    SinglyLinkedList<int> singly;
+    REQUIRE(array.begin() == array.end());
+    REQUIRE(linked.begin() == linked.end());
+    REQUIRE(singly.begin() == singly.end());
+    REQUIRE(array.find(1) == array.end());
+    REQUIRE(linked.find(1) == linked.end());
+    REQUIRE(array.count(1) == 0);
+    array.erase(0, 0);
+    REQUIRE(array.remove_if([](int)
+                            { return true; }) == 0);
+    array.reverse();
+    linked.reverse();
+    singly.reverse();
+    array.clear();
+    linked.clear();
+    singly.clear();
+    REQUIRE(array == ArrayList<int>());
+    REQUIRE(linked == LinkedList<int>());
+    REQUIRE(singly == SinglyLinkedList<int>());
+
+    // the first insertion allocates
+    array.insert(0, 1);
+    linked.insert(0, 1);
+    singly.insert(0, 1);
+    REQUIRE(array == ArrayList<int>({1}));
+    REQUIRE(linked == LinkedList<int>({1}));
+    REQUIRE(singly == SinglyLinkedList<int>({1}));
+    linked.insert(0, 0);
+    REQUIRE(linked.reverse() == LinkedList<int>({1, 0}));
+}
+
 TEST_CASE("LinkedList")
 {
     test<LinkedList<int>>();
@@ -1,6 +1,8 @@
 #include "tool.hpp"
 
 #include "../sources/Map/HashMap.hpp"
+#include "../sources/Map/OrderedHashMap.hpp"
+#include "../sources/common/ThreadPool.hpp"
 
 using namespace hellods;
 
@@ -93,6 +95,25 @@ void test()
     REQUIRE(empty.remove(1) == false);
     REQUIRE(empty == Map({}));
 
+    auto [it1, inserted1] = empty.try_emplace(1, "one");
+    REQUIRE(inserted1 == true);
+    REQUIRE(*it1 == std::pair{1, "one"});
+    auto [it2, inserted2] = empty.try_emplace(1, "one!");
+    REQUIRE(inserted2 == false);
+    REQUIRE(*it2 == std::pair{1, "one"});
+    REQUIRE(empty.insert_or_assign(2, "two") == true);
+    REQUIRE(empty.insert_or_assign(2, "two!") == false);
+    REQUIRE(empty == Map({{1, "one"}, {2, "two!"}}));
+    REQUIRE(empty.find_or_insert(1) == "one");
+    empty.find_or_insert(3) = "three";
+    REQUIRE(empty == Map({{1, "one"}, {2, "two!"}, {3, "three"}}));
+    REQUIRE(empty.find_or_insert(4, "four") == "four");
+    REQUIRE(empty.get_or_default(4) == "four");
+    REQUIRE(empty.get_or_default(5) == "");
+    REQUIRE(empty.get_or_default(5, "five") == "five");
+    REQUIRE(empty.size() == 4);
+    empty.clear();
+
     some.clear();
     REQUIRE(some == empty);
     some.clear(); // double clear
@@ -124,12 +145,248 @@ struct std::hash<EqType> // explicit specialization
     }
 };
 
+// Transparent string hash, for heterogeneous lookup.
+struct StringHash
+{
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view sv) const
+    {
+        return std::hash<std::string_view>()(sv);
+    }
+};
+
 TEST_CASE("HashMap")
 {
     test<HashMap<int, std::string>>();
+    test<HashMap<int, std::string, std::hash<int>, std::equal_to<int>, true>>();
+
+    HashMap<std::string, int, StringHash, std::equal_to<>> words = {{"one", 1}, {"two", 2}, {"three", 3}};
+    REQUIRE(*words.find(std::string_view("one")) == std::pair<const std::string, int>{"one", 1});
+    REQUIRE(words.find("four") == words.end());
+    REQUIRE(words.contains("two") == true);
+    REQUIRE(words.contains(std::string_view("four")) == false);
+    REQUIRE(words["three"] == 3);
+    words[std::string_view("three")] = 33;
+    REQUIRE(std::as_const(words)["three"] == 33);
+    REQUIRE_THROWS_MATCHES(words["four"], std::runtime_error, Message("Error: The key-value pair does not exist."));
+    REQUIRE(words.remove("one") == true);
+    REQUIRE(words.remove(std::string_view("one")) == false);
+    REQUIRE(words.size() == 2);
 
     HashMap<EqType, EqType> empty;
     HashMap<EqType, EqType> some = {{EqType(), EqType()}, {EqType(), EqType()}, {EqType(), EqType()}};
     REQUIRE(empty.size() == 0);
     REQUIRE(some.size() == 3);
+
+    HashMap<int, int> counter;
+    for (int i = 0; i < 1000; i++)
+    {
+        ++counter.find_or_insert(i % 10);
+    }
+    REQUIRE(counter.size() == 10);
+    REQUIRE(counter[0] == 100);
+    REQUIRE(counter[9] == 100);
+
+    HashMap<std::string, int, FastHash, std::equal_to<>, true> cached;
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(cached.insert(std::to_string(i), i) == true);
+    }
+    REQUIRE(cached.size() == 1000);
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(cached[std::to_string(i)] == i);
+    }
+    REQUIRE(cached.contains(std::string_view("999")) == true);
+    REQUIRE(cached.contains("1000") == false);
+    REQUIRE(cached.remove("0") == true);
+    REQUIRE(cached.size() == 999);
+}
+
+TEST_CASE("OrderedHashMap")
+{
+    test<OrderedHashMap<int, std::string>>();
+
+    OrderedHashMap<int, int> ordered = {{5, 0}, {3, 1}, {9, 2}, {1, 3}};
+    std::ostringstream oss;
+    oss << ordered;
+    REQUIRE(oss.str() == "Map(5: 0, 3: 1, 9: 2, 1: 3)");
+    oss.str("");
+
+    ordered.remove(3);
+    ordered.insert(3, 4);
+    ordered.insert_or_assign(5, 5);
+    oss << ordered;
+    REQUIRE(oss.str() == "Map(5: 5, 9: 2, 1: 3, 3: 4)");
+    oss.str("");
+
+    OrderedHashMap<int, int> big;
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(big.insert(i, i * i) == true);
+    }
+    for (int i = 0; i < 1000; i += 3)
+    {
+        REQUIRE(big.remove(i) == true);
+    }
+    REQUIRE(big.size() == 666);
+    int last = -1;
+    int count = 0;
+    for (const auto& [key, value] : big)
+    {
+        REQUIRE(key % 3 != 0);
+        REQUIRE(key > last);
+        REQUIRE(value == key * key);
+        last = key;
+        count++;
+    }
+    REQUIRE(count == 666);
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(big.contains(i) == (i % 3 != 0));
+    }
+    for (int i = 0; i < 1000; i++)
+    {
+        big.remove(i);
+    }
+    REQUIRE(big.is_empty() == true);
+    REQUIRE(big.begin() == big.end());
+
+    // a drained map keeps its capacity and compacts in place while pairs come and go
+    for (int i = 0; i < 10000; i++)
+    {
+        big.insert(i % 3, i);
+        big.insert(i + 1000, i);
+        REQUIRE(big.remove(i + 1000) == true);
+        if (i % 7 == 0)
+        {
+            big.remove(i % 3);
+        }
+    }
+    REQUIRE(big.size() == 3);
+    oss << big;
+    REQUIRE(oss.str() == "Map(1: 9985, 2: 9992, 0: 9999)");
+    oss.str("");
+}
+
+TEST_CASE("OrderedHashMap copy and move")
+{
+    OrderedHashMap<int, std::string> map = {{5, "five"}, {3, "three"}, {9, "nine"}};
+    map.remove(3);
+
+    // copies own their entries and keep the order, without the removed pairs
+    OrderedHashMap<int, std::string> copy = map;
+    copy.insert(1, "one");
+    std::ostringstream oss;
+    oss << map << copy;
+    REQUIRE(oss.str() == "Map(5: five, 9: nine)Map(5: five, 9: nine, 1: one)");
+
+    copy = map;
+    REQUIRE(copy == map);
+    auto& alias = copy;
+    copy = alias;
+    REQUIRE(copy == map);
+    copy = OrderedHashMap<int, std::string>();
+    REQUIRE(copy.is_empty() == true);
+    REQUIRE(copy.insert(2, "two") == true);
+
+    OrderedHashMap<int, std::string> moved = std::move(map);
+    REQUIRE(moved.size() == 2);
+    REQUIRE(map.is_empty() == true);
+    REQUIRE(map.contains(5) == false);
+    REQUIRE(map.insert(7, "seven") == true);
+    map = std::move(moved);
+    REQUIRE(map == OrderedHashMap<int, std::string>({{5, "five"}, {9, "nine"}}));
+    REQUIRE(moved.begin() == moved.end());
+}
+
+TEST_CASE("OrderedHashMap parallel map")
+{
+    OrderedHashMap<int, long long> map;
+    for (int i = 0; i < 100000; i++)
+    {
+        map.insert(i, i);
+    }
+    for (int i = 0; i < 100000; i += 5)
+    {
+        map.remove(i);
+    }
+
+    common::ThreadPool pool(4);
+    auto square = [](std::pair<const int, long long>& pair)
+    { pair.second *= pair.second; };
+    map.map(pool, square);
+
+    long long count = 0;
+    for (const auto& [key, value] : map)
+    {
+        REQUIRE(value == (long long)key * key);
+        count++;
+    }
+    REQUIRE(count == 80000);
+
+    // small maps run serially
+    OrderedHashMap<int, long long> small = {{2, 3}, {4, 5}};
+    small.map(pool, square);
+    REQUIRE(small == OrderedHashMap<int, long long>({{2, 9}, {4, 25}}));
+}
+
+TEST_CASE("Map size type")
+{
+    // sizes and iterator differences are pointer-sized, not limited to int
+    STATIC_REQUIRE(std::is_same_v<decltype(HashMap<int, int>().size()), std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(OrderedHashMap<int, int>().size()), std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<HashMap<int, int>::Iterator>::difference_type, std::ptrdiff_t>);
+    STATIC_REQUIRE(std::is_same_v<std::iterator_traits<OrderedHashMap<int, int>::Iterator>::difference_type, std::ptrdiff_t>);
+}
+
+TEST_CASE("Map lazy allocation")
+{
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<HashMap<int, std::string>>);
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<OrderedHashMap<int, std::string>>);
+
+    // operations on maps that have not allocated yet
+    HashMap<int, int> hash;
+    OrderedHashMap<int, int> ordered;
+    REQUIRE(hash.begin() == hash.end());
+    REQUIRE(ordered.begin() == ordered.end());
+    REQUIRE(hash.contains(1) == false);
+    REQUIRE(ordered.contains(1) == false);
+    REQUIRE(hash.get_or_default(1, 2) == 2);
+    REQUIRE(ordered.get_or_default(1, 2) == 2);
+    REQUIRE(hash.remove(1) == false);
+    REQUIRE(ordered.remove(1) == false);
+    REQUIRE_THROWS_MATCHES(hash[1], std::runtime_error, Message("Error: The key-value pair does not exist."));
+    hash.clear();
+    ordered.clear();
+
+    // the first insertion allocates
+    REQUIRE(hash.insert(1, 1) == true);
+    REQUIRE(ordered.insert(1, 1) == true);
+    REQUIRE(hash == HashMap<int, int>({{1, 1}}));
+    REQUIRE(ordered == OrderedHashMap<int, int>({{1, 1}}));
+}
+
+TEST_CASE("FastHash")
+{
+    FastHash seeded(42);
+    REQUIRE(seeded("hello") == FastHash(42)(std::string("hello")));
+    REQUIRE(seeded("hello") != FastHash(43)("hello"));
+    REQUIRE(seeded("hello") != seeded("hellp"));
+    REQUIRE(seeded(std::string(100, 'x')) != seeded(std::string(101, 'x')));
+    REQUIRE(seeded("") == seeded(std::string_view()));
+    REQUIRE(seeded(1) == FastHash(42)(1));
+    REQUIRE(seeded(1) != seeded(2));
+    REQUIRE(FastHash()("hello") != FastHash()("hello")); // random seed per object
+
+    HashMap<int, int, FastHash> map{FastHash(7)};
+    for (int i = 0; i < 100; i++)
+    {
+        map.insert(i, i * i);
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(map[i] == i * i);
+    }
 }
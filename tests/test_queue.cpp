@@ -69,6 +69,8 @@ TEST_CASE("ArrayQueue")
 {
     test<ArrayQueue<int>>();
     test<ArrayQueue<double>>();
+    test<ArrayQueue<int, common::NoShrink, common::HalfGrowth>>();
+    test<ArrayQueue<int, common::NoShrink, common::SizeClassGrowth>>();
 
     ArrayQueue<EqType> empty;
     ArrayQueue<EqType> some = {EqType(), EqType(), EqType(), EqType(), EqType()};
@@ -76,6 +78,33 @@ TEST_CASE("ArrayQueue")
     REQUIRE(some.size() == 5);
 }
 
+TEST_CASE("ArrayQueue shrink")
+{
+    test<ArrayQueue<int, common::QuarterShrink>>();
+
+    ArrayQueue<int, common::QuarterShrink> queue;
+    for (int i = 0; i < 100; i++)
+    {
+        queue.enqueue(i);
+    }
+    while (queue.size() > 5)
+    {
+        queue.dequeue();
+    }
+    REQUIRE(queue.capacity() == 16);
+    queue.shrink_to_fit();
+    REQUIRE(queue.capacity() == 5);
+    REQUIRE(queue.front() == 95);
+
+    // copies own their buffers
+    ArrayQueue<int, common::QuarterShrink> copy = queue;
+    copy.dequeue();
+    REQUIRE(queue.front() == 95);
+    REQUIRE(copy.front() == 96);
+    queue = copy;
+    REQUIRE(queue == copy);
+}
+
 TEST_CASE("LinkedQueue")
 {
     test<LinkedQueue<int>>();
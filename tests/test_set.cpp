@@ -0,0 +1,145 @@
+#include "tool.hpp"
+
+#include "../sources/Set/DisjointSet.hpp"
+#include "../sources/common/ThreadPool.hpp"
+
+#include <vector>
+
+using namespace hellods;
+
+template <typename Set>
+void test()
+{
+    // Constructor / Destructor
+    Set empty;
+    Set some(6);
+
+    // Examination
+    REQUIRE(empty.size() == 0);
+    REQUIRE(some.size() == 6);
+
+    REQUIRE(empty.is_empty() == true);
+    REQUIRE(some.is_empty() == false);
+
+    REQUIRE(empty.set_count() == 0);
+    REQUIRE(some.set_count() == 6);
+
+    REQUIRE_THROWS_MATCHES(empty.find(0), std::runtime_error, Message("Error: Index out of range."));
+    REQUIRE(some.find(3) == 3);
+    REQUIRE(some.is_connected(0, 1) == false);
+    REQUIRE(some.is_connected(2, 2) == true);
+
+    // Manipulation
+    REQUIRE(some.unite(0, 1) == true);
+    REQUIRE(some.unite(2, 3) == true);
+    REQUIRE(some.unite(1, 0) == false);
+    REQUIRE(some.set_count() == 4);
+    REQUIRE(some.is_connected(0, 1) == true);
+    REQUIRE(some.is_connected(1, 2) == false);
+
+    REQUIRE(some.unite(1, 3) == true);
+    REQUIRE(some.unite(0, 2) == false);
+    REQUIRE(some.set_count() == 3);
+    REQUIRE(some.find(0) == some.find(3));
+    REQUIRE(some.find(4) != some.find(5));
+    REQUIRE_THROWS_MATCHES(some.unite(0, 6), std::runtime_error, Message("Error: Index out of range."));
+    REQUIRE(some.connected_components() == std::vector<typename Set::size_type>{0, 0, 0, 0, 1, 2});
+
+    // batched
+    std::vector<std::pair<int, int>> edges = {{4, 5}, {5, 4}, {0, 6}};
+    REQUIRE_THROWS_MATCHES(some.unite_all(edges.begin(), edges.end()), std::runtime_error, Message("Error: Index out of range."));
+    REQUIRE(some.set_count() == 3);
+    edges.pop_back();
+    REQUIRE(some.unite_all(edges.begin(), edges.end()) == 1);
+    REQUIRE(some.connected_components() == std::vector<typename Set::size_type>{0, 0, 0, 0, 1, 1});
+
+    // a long chain stays shallow
+    Set chain(10000);
+    for (int i = 1; i < 10000; i++)
+    {
+        chain.unite(i - 1, i);
+    }
+    REQUIRE(chain.set_count() == 1);
+    REQUIRE(chain.is_connected(0, 9999));
+
+    some.clear();
+    REQUIRE(some.size() == 0);
+    REQUIRE(some.set_count() == 0);
+    some.clear(); // double clear
+    REQUIRE(some.is_empty());
+}
+
+TEST_CASE("DisjointSet")
+{
+    test<DisjointSet>();
+    test<ConcurrentDisjointSet>();
+
+    DisjointSet some(6);
+    some.unite(0, 1);
+    some.unite(2, 1);
+    REQUIRE(some.set_size(0) == 3);
+    REQUIRE(some.set_size(5) == 1);
+    REQUIRE(some.find(2) == some.find(0));
+    REQUIRE_THROWS_MATCHES(some.set_size(-1), std::runtime_error, Message("Error: Index out of range."));
+
+    // copy and move
+    DisjointSet copy(some);
+    copy.unite(4, 5);
+    REQUIRE(copy.set_count() == 3);
+    REQUIRE(some.set_count() == 4);
+    REQUIRE(some.is_connected(4, 5) == false);
+    auto& alias = copy;
+    copy = alias; // self assignment
+    REQUIRE(copy.is_connected(4, 5) == true);
+    some = copy;
+    REQUIRE(some.is_connected(4, 5) == true);
+    REQUIRE(DisjointSet(DisjointSet()).size() == 0);
+
+    DisjointSet moved(std::move(copy));
+    REQUIRE(moved.set_count() == 3);
+    REQUIRE(copy.size() == 0);
+    REQUIRE(copy.set_count() == 0);
+    copy = std::move(moved);
+    REQUIRE(copy.set_size(4) == 2);
+    REQUIRE(moved.is_empty());
+
+    STATIC_REQUIRE(std::is_copy_constructible_v<ConcurrentDisjointSet> == false);
+    STATIC_REQUIRE(std::is_copy_assignable_v<ConcurrentDisjointSet> == false);
+}
+
+TEST_CASE("ConcurrentDisjointSet parallel")
+{
+    // many threads uniting overlapping edges give the same sets as one thread
+    const int n = 100000;
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < n; i++)
+    {
+        if (i % 1000 != 999)
+        {
+            edges.push_back({i, (i * 7 + 3) % n});
+            edges.push_back({(i + 1) % n, i});
+        }
+    }
+
+    DisjointSet serial(n);
+    auto merges = serial.unite_all(edges.begin(), edges.end());
+
+    common::ThreadPool pool(4);
+    ConcurrentDisjointSet concurrent(n);
+    REQUIRE(concurrent.unite_all(pool, edges.begin(), edges.end()) == merges);
+    REQUIRE(concurrent.set_count() == serial.set_count());
+    REQUIRE(concurrent.connected_components() == serial.connected_components());
+
+    // concurrent queries while uniting
+    ConcurrentDisjointSet chain(n);
+    pool.run(4, [&](int task)
+             {
+                 for (int i = task; i + 1 < n; i += 4)
+                 {
+                     chain.unite(i, i + 1);
+                     chain.is_connected(i, 0);
+                 }
+             });
+    REQUIRE(chain.set_count() == 1);
+    REQUIRE(chain.find(n - 1) == 0);
+}
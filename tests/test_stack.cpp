@@ -2,6 +2,7 @@
 
 #include "../sources/Stack/ArrayStack.hpp"
 #include "../sources/Stack/LinkedStack.hpp"
+#include "../sources/Stack/SmallArrayStack.hpp"
 
 using namespace hellods;
 
@@ -69,6 +70,8 @@ TEST_CASE("ArrayStack")
 {
     test<ArrayStack<int>>();
     test<ArrayStack<double>>();
+    test<ArrayStack<int, common::NoShrink, common::HalfGrowth>>();
+    test<ArrayStack<int, common::NoShrink, common::SizeClassGrowth>>();
 
     ArrayStack<EqType> empty;
     ArrayStack<EqType> some = {EqType(), EqType(), EqType(), EqType(), EqType()};
@@ -76,6 +79,45 @@ TEST_CASE("ArrayStack")
     REQUIRE(some.size() == 5);
 }
 
+TEST_CASE("SmallArrayStack")
+{
+    test<SmallArrayStack<int, 4>>();
+    test<SmallArrayStack<double, 16>>();
+
+    SmallArrayStack<int, 2> stack;
+    stack.push(1);
+    stack.push(2);
+    REQUIRE(stack.is_inline());
+    stack.push(3);
+    REQUIRE(stack.is_inline() == false);
+    REQUIRE(stack.pop() == 3);
+    REQUIRE(stack.top() == 2);
+
+    SmallArrayStack<int, 2> copy = stack;
+    copy.push(4);
+    REQUIRE(stack.size() == 2);
+    REQUIRE(copy.size() == 3);
+}
+
+TEST_CASE("ArrayStack shrink")
+{
+    test<ArrayStack<int, common::QuarterShrink>>();
+
+    ArrayStack<int, common::QuarterShrink> stack;
+    for (int i = 0; i < 100; i++)
+    {
+        stack.push(i);
+    }
+    while (stack.size() > 5)
+    {
+        stack.pop();
+    }
+    REQUIRE(stack.capacity() == 16);
+    stack.shrink_to_fit();
+    REQUIRE(stack.capacity() == 5);
+    REQUIRE(stack.top() == 4);
+}
+
 TEST_CASE("LinkedStack")
 {
     test<LinkedStack<int>>();
@@ -92,6 +92,32 @@ void test()
     REQUIRE(empty.contains(1) == false);
     REQUIRE(empty.contains(0) == false);
 
+    REQUIRE(empty.lower_bound(1) == empty.end());
+    REQUIRE(*some.lower_bound(0) == 1);
+    REQUIRE(*some.lower_bound(3) == 3);
+    REQUIRE(some.lower_bound(6) == some.end());
+
+    REQUIRE(empty.upper_bound(1) == empty.end());
+    REQUIRE(*some.upper_bound(0) == 1);
+    REQUIRE(*some.upper_bound(3) == 4);
+    REQUIRE(some.upper_bound(5) == some.end());
+
+    auto [lo, hi] = some.equal_range(3);
+    REQUIRE(*lo == 3);
+    REQUIRE(*hi == 4);
+    REQUIRE(some.equal_range(6).first == some.equal_range(6).second);
+
+    i = 2;
+    for (const auto& e : some.range(2, 5))
+    {
+        REQUIRE(e == i++);
+    }
+    REQUIRE(i == 5);
+    REQUIRE(some.range(0, 9).begin() == some.begin());
+    REQUIRE(some.range(0, 9).end() == some.end());
+    REQUIRE(some.range(4, 2).is_empty() == true);
+    REQUIRE(empty.range(0, 9).is_empty() == true);
+
     REQUIRE(some.depth() == 3);
     REQUIRE(empty.depth() == 0);
 
@@ -155,10 +181,37 @@ TEST_CASE("BinarySearchTree")
     test<BinarySearchTree<int>>();
 }
 
+TEST_CASE("Tree lazy allocation")
+{
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<BinarySearchTree<int>>);
+    STATIC_REQUIRE(std::is_nothrow_default_constructible_v<RedBlackTree<int>>);
+}
+
 TEST_CASE("RedBlackTree")
 {
     test<RedBlackTree<int>>();
 
+    // heterogeneous lookup with a transparent comparator
+    RedBlackTree<std::string, std::less<>> words = {"apple", "banana", "cherry"};
+    REQUIRE(*words.find(std::string_view("banana")) == "banana");
+    REQUIRE(words.contains("cherry") == true);
+    REQUIRE(words.contains("durian") == false);
+    REQUIRE(*words.lower_bound("b") == "banana");
+    REQUIRE(*words.upper_bound(std::string_view("banana")) == "cherry");
+    REQUIRE(words.remove("apple") == true);
+    REQUIRE(words.remove(std::string_view("apple")) == false);
+    REQUIRE(words.size() == 2);
+
+    // without a transparent comparator the key is converted to T, as before
+    RedBlackTree<int> numbers = {1, 3, 5};
+    REQUIRE(numbers.contains(3.5) == true);
+    REQUIRE(*numbers.lower_bound(2.9) == 3);
+    REQUIRE(numbers.remove(5.5) == true);
+    REQUIRE(numbers.size() == 2);
+    BinarySearchTree<int, std::less<>> exact = {1, 3, 5};
+    REQUIRE(exact.contains(3.5) == false);
+    REQUIRE(*exact.lower_bound(2.9) == 3);
+
     RedBlackTree<EqLtType> empty;
     RedBlackTree<EqLtType> some = {EqLtType(), EqLtType(), EqLtType(), EqLtType(), EqLtType()};
     REQUIRE(empty.size() == 0);
@@ -9,7 +9,14 @@ target("test")
     set_kind("binary")
     add_packages("catch2")
     add_files("tests/*.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
 
 target("example")
     set_kind("binary")
     add_files("examples/*.cpp")
+
+target("benchmark")
+    set_kind("binary")
+    add_files("benchmarks/*.cpp")